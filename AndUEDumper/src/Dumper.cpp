@@ -1,5 +1,7 @@
 #include "Dumper.hpp"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <nlohmann/json.hpp>
@@ -47,29 +49,133 @@ bool UEDumper::Init(IGameProfile *profile)
         return false;
     }
     _profile = profile;
+    _snapshot = nullptr;
+    return true;
+}
+
+bool UEDumper::Init(IGameProfile *profile, const UESnapshotFile *snapshot)
+{
+    if (!snapshot || !snapshot->IsOpen())
+    {
+        _lastError = UEVars::InitStatusToStr(UEVarsInitStatus::ERROR_INIT_SNAPSHOT);
+        return false;
+    }
+
+    UEMemory::SetBackend(snapshot);
+
+    UEVarsInitStatus initStatus = profile->InitUEVars(*snapshot);
+    if (initStatus != UEVarsInitStatus::SUCCESS)
+    {
+        UEMemory::SetBackend(nullptr);
+        _lastError = UEVars::InitStatusToStr(initStatus);
+        return false;
+    }
+    _profile = profile;
+    _snapshot = snapshot;
     return true;
 }
 
+std::vector<KittyMemoryEx::ProcMap> UEDumper::GetUnrealEngineSegments() const
+{
+    if (_snapshot)
+        return _snapshot->GetSegments();
+
+    return _profile->GetUnrealEngineELF().segments();
+}
+
+void UEDumper::BeginPhase(const std::string &name)
+{
+    UEDumperPhaseStats phase{};
+    phase.name = name;
+    _stats.phases.push_back(phase);
+
+    UEMemory::Trace::SetPhase(name);
+
+    _phaseReads = UEMemory::GetReadStats();
+    _phaseStart = std::chrono::steady_clock::now();
+}
+
+void UEDumper::EndPhase()
+{
+    if (_stats.phases.empty())
+        return;
+
+    auto &phase = _stats.phases.back();
+    phase.wallMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _phaseStart).count();
+    phase.reads = UEMemory::GetReadStats() - _phaseReads;
+
+    _stats.totalMS += phase.wallMS;
+    _stats.totalReads.calls += phase.reads.calls;
+    _stats.totalReads.bytes += phase.reads.bytes;
+    _stats.totalReads.failed += phase.reads.failed;
+    _stats.totalReads.rejected += phase.reads.rejected;
+    _stats.totalReads.targetReads += phase.reads.targetReads;
+}
+
+void UEDumper::DumpStats(BufferFmt &logsBufferFmt)
+{
+    UEDumperPhaseStats total{};
+    total.name = "Total";
+    total.wallMS = _stats.totalMS;
+    total.reads = _stats.totalReads;
+
+    logsBufferFmt.append("Dump Stats:\n");
+    logsBufferFmt.append("{:<16} {:>10} {:>10} {:>12} {:>10} {:>8} {:>8} {:>12}\n",
+                         "Phase", "Time(ms)", "Reads", "Bytes", "Target", "Failed", "Rejected", "Reads/s");
+
+    auto appendRow = [&logsBufferFmt](const UEDumperPhaseStats &phase)
+    {
+        logsBufferFmt.append("{:<16} {:>10.2f} {:>10} {:>12} {:>10} {:>8} {:>8} {:>12.0f}\n",
+                             phase.name, phase.wallMS, phase.reads.calls, phase.reads.bytes, phase.reads.targetReads,
+                             phase.reads.failed, phase.reads.rejected, phase.readsPerSec());
+    };
+
+    for (const auto &phase : _stats.phases)
+        appendRow(phase);
+
+    appendRow(total);
+
+    if (UEWrappers::IsObjectValidationEnabled())
+    {
+        logsBufferFmt.append("Objects Validation: validated {} | retries {} | skipped {}\n",
+                             _stats.validation.validated, _stats.validation.retries, _stats.validation.skipped);
+    }
+
+    logsBufferFmt.append("==========================\n");
+}
+
 bool UEDumper::Dump(std::unordered_map<std::string, BufferFmt> *outBuffersMap)
 {
     outBuffersMap->insert({"Logs.txt", BufferFmt()});
     BufferFmt &logsBufferFmt = outBuffersMap->at("Logs.txt");
 
+    _stats = {};
+    UEWrappers::ResetObjectValidationStats();
+
     {
         if (_dumpExeInfoNotify) _dumpExeInfoNotify(false);
+        BeginPhase("ExecutableInfo");
         DumpExecutableInfo(logsBufferFmt);
+        EndPhase();
         if (_dumpExeInfoNotify) _dumpExeInfoNotify(true);
     }
 
     {
         if (_dumpNamesInfoNotify) _dumpNamesInfoNotify(false);
-        DumpNamesInfo(logsBufferFmt);
+        outBuffersMap->insert({"Names.txt", BufferFmt()});
+        BeginPhase("NamesInfo");
+        DumpNamesInfo(logsBufferFmt, outBuffersMap->at("Names.txt"));
+        EndPhase();
+        if (outBuffersMap->at("Names.txt").empty())
+            outBuffersMap->erase("Names.txt");
         if (_dumpNamesInfoNotify) _dumpNamesInfoNotify(true);
     }
 
     {
         if (_dumpObjectsInfoNotify) _dumpObjectsInfoNotify(false);
+        BeginPhase("ObjectsInfo");
         DumpObjectsInfo(logsBufferFmt);
+        EndPhase();
         if (_dumpObjectsInfoNotify) _dumpObjectsInfoNotify(true);
     }
 
@@ -77,28 +183,81 @@ bool UEDumper::Dump(std::unordered_map<std::string, BufferFmt> *outBuffersMap)
         if (_dumpOffsetsInfoNotify) _dumpOffsetsInfoNotify(false);
         outBuffersMap->insert({"Offsets.hpp", BufferFmt()});
         BufferFmt &offsetsBufferFmt = outBuffersMap->at("Offsets.hpp");
+        BeginPhase("OffsetsInfo");
         DumpOffsetsInfo(logsBufferFmt, offsetsBufferFmt);
+        EndPhase();
         if (_dumpOffsetsInfoNotify) _dumpOffsetsInfoNotify(true);
     }
 
     outBuffersMap->insert({"Objects.txt", BufferFmt()});
     BufferFmt &objsBufferFmt = outBuffersMap->at("Objects.txt");
     std::vector<std::pair<uint8_t *const, std::vector<UE_UObject>>> packages;
+    BeginPhase("GatherUObjects");
     GatherUObjects(logsBufferFmt, objsBufferFmt, packages, _objectsProgressCallback);
+    EndPhase();
 
     if (packages.empty())
     {
         logsBufferFmt.append("Error: Packages are empty.\n");
         logsBufferFmt.append("==========================\n");
+        _stats.validation = UEWrappers::GetObjectValidationStats();
+        DumpStats(logsBufferFmt);
         _lastError = "ERROR_EMPTY_PACKAGES";
         return false;
     }
 
+    if (Mirror::IsEnabled())
+        CountChangedObjects(packages);
+
     outBuffersMap->insert({"AIOHeader.hpp", BufferFmt()});
     BufferFmt &aioBufferFmt = outBuffersMap->at("AIOHeader.hpp");
+    BeginPhase("DumpAIOHeader");
     DumpAIOHeader(logsBufferFmt, aioBufferFmt, packages, _dumpProgressCallback);
+    EndPhase();
 
-    dumper_jf_ns::base_address = _profile->GetUnrealEngineELF().base();
+    if (PageCache::IsEnabled())
+    {
+        auto cacheStats = PageCache::GetStats();
+        logsBufferFmt.append("Page Cache:\nHits: {}\nMisses: {}\nEvictions: {}\nFailed Fetches: {}\nCached Pages: {}\n",
+                             cacheStats.hits, cacheStats.misses, cacheStats.evictions, cacheStats.failedFetches, cacheStats.pages);
+        logsBufferFmt.append("==========================\n");
+    }
+
+    _stats.names = _profile->GetUEVars()->GetNamesCacheStats();
+    logsBufferFmt.append("Names Cache:\nNames: {}\nCapacity: {}\nMemory: {} KB\nHits: {}\nMisses: {}\nHit Rate: {:.2f}%\n",
+                         _stats.names.names, _stats.names.capacity, _stats.names.memoryBytes / 1024,
+                         _stats.names.hits, _stats.names.misses, _stats.names.hitRate());
+    logsBufferFmt.append("==========================\n");
+
+    _stats.nameArena = UEWrappers::GetNameArenaStats();
+    logsBufferFmt.append("Name Arena:\nNames: {}\nChunks: {}\nMemory: {} KB\nInterned Again: {}\nHit Rate: {:.2f}%\n",
+                         _stats.nameArena.names, _stats.nameArena.chunks, _stats.nameArena.memoryBytes / 1024,
+                         _stats.nameArena.hits, _stats.nameArena.hitRate());
+    logsBufferFmt.append("==========================\n");
+
+    _stats.displayNames = UEWrappers::GetDisplayNamesStats();
+    logsBufferFmt.append("Display Names:\nNames: {}\nHits: {}\nMisses: {}\nHit Rate: {:.2f}%\n",
+                         _stats.displayNames.names, _stats.displayNames.hits, _stats.displayNames.misses, _stats.displayNames.hitRate());
+    logsBufferFmt.append("==========================\n");
+
+    if (Mirror::IsEnabled())
+    {
+        size_t objectsCount = 0;
+        for (const auto &package : packages)
+            objectsCount += package.second.size();
+
+        _stats.mirror = Mirror::GetStats();
+        const auto &mirrorStats = _stats.mirror;
+        logsBufferFmt.append("Page Mirror:\nPages: {}\nRefreshed: {} in {} bulk reads ({:.2f}ms)\nClean: {}\nChanged: {}\nNew: {}\nDropped: {}\nHits: {}\nMisses: {}\n",
+                             mirrorStats.pages, mirrorStats.refreshed, mirrorStats.bulkReads, mirrorStats.refreshMS,
+                             mirrorStats.clean, mirrorStats.changed, mirrorStats.newPages, mirrorStats.dropped, mirrorStats.hits, mirrorStats.misses);
+        logsBufferFmt.append("Changed Objects: {} / {}\nChanged Packages: {} / {}\n",
+                             _stats.changedObjects, objectsCount, _stats.changedPackages, packages.size());
+        logsBufferFmt.append("==========================\n");
+    }
+
+    BeginPhase("script.json");
+    dumper_jf_ns::base_address = _profile->GetUEVars()->GetBaseAddress();
     if (dumper_jf_ns::jsonFunctions.size())
     {
         logsBufferFmt.append("Generating script json...\nFunctions: {}\n", dumper_jf_ns::jsonFunctions.size());
@@ -115,24 +274,40 @@ bool UEDumper::Dump(std::unordered_map<std::string, BufferFmt> *outBuffersMap)
 
         scriptBufferFmt.append("{}", js.dump(4));
     }
+    EndPhase();
+
+    _stats.validation = UEWrappers::GetObjectValidationStats();
+    DumpStats(logsBufferFmt);
 
     return true;
 }
 
 void UEDumper::DumpExecutableInfo(BufferFmt &logsBufferFmt)
 {
-    auto ue_elf = _profile->GetUnrealEngineELF();
-    logsBufferFmt.append("e_machine: 0x{:X}\n", ue_elf.header().e_machine);
-    logsBufferFmt.append("Library: {}\n", ue_elf.filePath().c_str());
-    logsBufferFmt.append("BaseAddress: 0x{:X}\n", ue_elf.base());
+    if (_snapshot)
+    {
+        logsBufferFmt.append("Snapshot: {}\n", _snapshot->GetPackage());
+        logsBufferFmt.append("e_machine: 0x{:X}\n", _snapshot->GetHeader().e_machine);
+        logsBufferFmt.append("Library: {}\n", _snapshot->GetLibPath());
+    }
+    else
+    {
+        auto ue_elf = _profile->GetUnrealEngineELF();
+        logsBufferFmt.append("e_machine: 0x{:X}\n", ue_elf.header().e_machine);
+        logsBufferFmt.append("Library: {}\n", ue_elf.filePath().c_str());
+    }
+    logsBufferFmt.append("BaseAddress: 0x{:X}\n", _profile->GetUEVars()->GetBaseAddress());
 
-    for (const auto &it : ue_elf.segments())
+    for (const auto &it : GetUnrealEngineSegments())
         logsBufferFmt.append("{}\n", it.toString());
 
+    if (MemOps::GetCalibration().valid)
+        logsBufferFmt.append("{}\n", MemOps::GetCalibration().ToString());
+
     logsBufferFmt.append("==========================\n");
 }
 
-void UEDumper::DumpNamesInfo(BufferFmt &logsBufferFmt)
+void UEDumper::DumpNamesInfo(BufferFmt &logsBufferFmt, BufferFmt &namesBufferFmt)
 {
     uintptr_t baseAddr = _profile->GetUEVars()->GetBaseAddress();
     uintptr_t namesPtr = _profile->GetUEVars()->GetNamesPtr();
@@ -148,6 +323,15 @@ void UEDumper::DumpNamesInfo(BufferFmt &logsBufferFmt)
                              namesPtr - baseAddr, namesPtr);
     }
 
+    size_t namesCount = _profile->LoadNames([&namesBufferFmt](int32_t id, const std::string &name)
+    {
+        namesBufferFmt.append("[{:010}]: {}\n", id, name);
+    });
+    if (namesCount > 0)
+        logsBufferFmt.append("Loaded {} names in bulk\n", namesCount);
+    else
+        logsBufferFmt.append("Names table couldn't be loaded in bulk, names are read on demand\n");
+
     logsBufferFmt.append("Test dumping first 5 name entries\n");
     for (int i = 0; i < 5; i++)
     {
@@ -188,7 +372,7 @@ void UEDumper::DumpOffsetsInfo(BufferFmt &logsBufferFmt, BufferFmt &offsetsBuffe
     uintptr_t UEnginePtr = 0, UWorldPtr = 0;
     if (((UE_UObject)UEWrappers::GetObjects()->GetObjectPtr(1)).GetIndex() == 1)
     {
-        auto ueSegs = _profile->GetUnrealEngineELF().segments();
+        auto ueSegs = GetUnrealEngineSegments();
 
         UE_UClass UEngineClass = UEWrappers::GetObjects()->FindObject("Class Engine.Engine").Cast<UE_UClass>();
         UE_UClass UWorldClass = UEWrappers::GetObjects()->FindObject("Class Engine.World").Cast<UE_UClass>();
@@ -275,42 +459,133 @@ void UEDumper::GatherUObjects(BufferFmt &logsBufferFmt, BufferFmt &objsBufferFmt
     if (progressCallback)
         progressCallback(objectsProgress);
 
-    for (int i = 0; i < objectsCount; i++)
+    struct GatheredObject
     {
-        UE_UObject object = UEWrappers::GetObjects()->GetObjectPtr(i);
-        if (object)
+        UE_UObject object;
+        bool isPackageMember = false;
+        uint8_t *package = nullptr;
+        int32_t index = 0;
+        std::string fullName;
+    };
+
+    // each job loads and resolves one batch of the array, results are merged in order
+    const int32_t batchSize = UE_UObjectArray::kObjectsBatchSize;
+    const int32_t waveBatches = int32_t(ReadExecutor::GetThreadCount());
+    std::vector<std::vector<GatheredObject>> waveResults(waveBatches);
+
+    for (int32_t waveStart = 0; waveStart < objectsCount; waveStart += waveBatches * batchSize)
+    {
+        const int32_t batchesCount = std::min(waveBatches, (objectsCount - waveStart + batchSize - 1) / batchSize);
+
+        ReadExecutor::Run(size_t(batchesCount), [&](size_t batch)
         {
-            if (object.IsA<UE_UFunction>() || object.IsA<UE_UStruct>() || object.IsA<UE_UEnum>())
+            const int32_t start = waveStart + int32_t(batch) * batchSize;
+            const int32_t count = std::min(batchSize, objectsCount - start);
+
+            std::vector<uint8_t *> objectsBatch(count);
+            UEWrappers::GetObjects()->GetObjectPtrs(start, count, objectsBatch.data());
+
+            auto &results = waveResults[batch];
+            results.clear();
+            results.resize(count);
+
+            for (int32_t i = 0; i < count; i++)
             {
-                bool found = false;
-                auto packageObj = object.GetPackageObject();
-                for (auto &pkg : packages)
+                if (!objectsBatch[i]) continue;
+
+                auto &result = results[i];
+                auto resolve = [&result](UE_UObject object)
                 {
-                    if (pkg.first == packageObj)
+                    result = GatheredObject{};
+                    result.object = object;
+                    if (!object) return;
+
+                    if (object.IsA<UE_UFunction>() || object.IsA<UE_UStruct>() || object.IsA<UE_UEnum>())
                     {
-                        pkg.second.push_back(object);
-                        found = true;
-                        break;
+                        result.isPackageMember = true;
+                        result.package = object.GetPackageObject();
                     }
-                }
-                if (!found)
+
+                    result.index = object.GetIndex();
+                    object.GetFullName(&result.fullName);
+                };
+
+                if (!UEWrappers::IsObjectValidationEnabled())
+                    resolve(objectsBatch[i]);
+                else if (!UEWrappers::GetObjects()->ProcessValidated(start + i, resolve))
+                    result = GatheredObject{};
+            }
+        });
+
+        for (int32_t batch = 0; batch < batchesCount; batch++)
+        {
+            for (const auto &result : waveResults[batch])
+            {
+                if (result.object)
                 {
-                    packages.push_back(std::make_pair(packageObj, std::vector<UE_UObject>(1, object)));
+                    if (result.isPackageMember)
+                    {
+                        bool found = false;
+                        for (auto &pkg : packages)
+                        {
+                            if (pkg.first == result.package)
+                            {
+                                pkg.second.push_back(result.object);
+                                found = true;
+                                break;
+                            }
+                        }
+                        if (!found)
+                        {
+                            packages.push_back(std::make_pair(result.package, std::vector<UE_UObject>(1, result.object)));
+                        }
+                    }
+
+                    objsBufferFmt.append("[{:010}]: {}\n", result.index, result.fullName);
                 }
-            }
 
-            objsBufferFmt.append("[{:010}]: {}\n", object.GetIndex(), object.GetFullName());
+                objectsProgress++;
+                if (progressCallback)
+                    progressCallback(objectsProgress);
+            }
         }
-
-        objectsProgress++;
-        if (progressCallback)
-            progressCallback(objectsProgress);
     }
 
     logsBufferFmt.append("Gathered {} Objects (Packages {})\n", objectsCount, packages.size());
     logsBufferFmt.append("==========================\n");
 }
 
+void UEDumper::CountChangedObjects(const UEPackagesArray &packages)
+{
+    const auto *offsets = _profile->GetOffsets();
+    const auto &uobject = offsets->UObject;
+    const auto &ustruct = offsets->UStruct;
+
+    // header fields for all objects, struct fields too for the ones that generate code
+    const uintptr_t headerEnd = std::max({uobject.ClassPrivate, uobject.OuterPrivate, uobject.InternalIndex, uobject.NamePrivate}) + sizeof(uint64_t);
+    const uintptr_t structEnd = std::max({headerEnd, ustruct.SuperStruct + sizeof(void *), ustruct.Children + sizeof(void *),
+                                          ustruct.ChildProperties + sizeof(void *), ustruct.PropertiesSize + sizeof(int32_t)});
+
+    _stats.changedObjects = 0;
+    _stats.changedPackages = 0;
+    for (const auto &package : packages)
+    {
+        bool packageChanged = Mirror::IsChanged(package.first, headerEnd);
+        for (const auto &object : package.second)
+        {
+            const bool isStruct = object.IsA<UE_UStruct>();
+            if (Mirror::IsChanged(object.GetAddress(), isStruct ? structEnd : headerEnd))
+            {
+                _stats.changedObjects++;
+                packageChanged = true;
+            }
+        }
+
+        if (packageChanged)
+            _stats.changedPackages++;
+    }
+}
+
 void UEDumper::DumpAIOHeader(BufferFmt &logsBufferFmt, BufferFmt &aioBufferFmt, UEPackagesArray &packages, const ProgressCallback &progressCallback)
 {
     int packages_saved = 0;
@@ -328,55 +603,69 @@ void UEDumper::DumpAIOHeader(BufferFmt &logsBufferFmt, BufferFmt &aioBufferFmt,
     if (progressCallback)
         progressCallback(dumpProgress);
 
-    for (UE_UPackage package : packages)
+    // packages are processed in waves on the read workers, then appended in order
+    const size_t wavePackages = ReadExecutor::GetThreadCount() * 4;
+    std::vector<UE_UPackage> wave;
+
+    for (size_t waveStart = 0; waveStart < packages.size(); waveStart += wavePackages)
     {
-        package.Process();
+        wave.clear();
+        for (size_t i = waveStart; i < std::min(packages.size(), waveStart + wavePackages); i++)
+            wave.emplace_back(packages[i]);
 
-        dumpProgress++;
-        if (progressCallback)
-            progressCallback(dumpProgress);
+        ReadExecutor::Run(wave.size(), [&wave](size_t i)
+        {
+            wave[i].Process();
+        });
 
-        if (!package.AppendToBuffer(&aioBufferFmt))
+        for (UE_UPackage &package : wave)
         {
-            packages_unsaved += "\t";
-            packages_unsaved += (package.GetObject().GetName() + ",\n");
-            continue;
-        }
+            dumpProgress++;
+            if (progressCallback)
+                progressCallback(dumpProgress);
 
-        packages_saved++;
-        classes_saved += package.Classes.size();
-        structs_saved += package.Structures.size();
-        enums_saved += package.Enums.size();
+            if (!package.AppendToBuffer(&aioBufferFmt))
+            {
+                packages_unsaved += "\t";
+                packages_unsaved += (package.GetObject().GetName() + ",\n");
+                continue;
+            }
 
-        for (const auto &cls : package.Classes)
-        {
-            for (const auto &func : cls.Functions)
+            packages_saved++;
+            classes_saved += package.Classes.size();
+            structs_saved += package.Structures.size();
+            enums_saved += package.Enums.size();
+
+            for (const auto &cls : package.Classes)
             {
-                // UObject::ProcessInternal for blueprint functions
-                if (!processInternal_once && (func.EFlags & FUNC_BlueprintEvent) && func.Func)
+                for (const auto &func : cls.Functions)
                 {
-                    dumper_jf_ns::jsonFunctions.push_back({"UObject", "ProcessInternal", func.Func});
-                    processInternal_once = true;
-                }
+                    // UObject::ProcessInternal for blueprint functions
+                    if (!processInternal_once && (func.EFlags & FUNC_BlueprintEvent) && func.Func)
+                    {
+                        dumper_jf_ns::jsonFunctions.push_back({"UObject", "ProcessInternal", func.Func});
+                        processInternal_once = true;
+                    }
 
-                if ((func.EFlags & FUNC_Native) && func.Func)
-                {
-                    std::string execFuncName = "exec";
-                    execFuncName += func.Name;
-                    dumper_jf_ns::jsonFunctions.push_back({cls.Name, execFuncName, func.Func});
+                    if ((func.EFlags & FUNC_Native) && func.Func)
+                    {
+                        std::string execFuncName = "exec";
+                        execFuncName += func.Name;
+                        dumper_jf_ns::jsonFunctions.push_back({cls.Name, execFuncName, func.Func});
+                    }
                 }
             }
-        }
 
-        for (const auto &st : package.Structures)
-        {
-            for (const auto &func : st.Functions)
+            for (const auto &st : package.Structures)
             {
-                if ((func.EFlags & FUNC_Native) && func.Func)
+                for (const auto &func : st.Functions)
                 {
-                    std::string execFuncName = "exec";
-                    execFuncName += func.Name;
-                    dumper_jf_ns::jsonFunctions.push_back({st.Name, execFuncName, func.Func});
+                    if ((func.EFlags & FUNC_Native) && func.Func)
+                    {
+                        std::string execFuncName = "exec";
+                        execFuncName += func.Name;
+                        dumper_jf_ns::jsonFunctions.push_back({st.Name, execFuncName, func.Func});
+                    }
                 }
             }
         }
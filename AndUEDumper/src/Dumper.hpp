@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "UE/UEGameProfile.hpp"
+#include "UE/UESnapshot.hpp"
 #include "UE/UEWrappers.hpp"
 
 #include "Utils/BufferFmt.hpp"
@@ -14,9 +16,35 @@
 using ProgressCallback = std::function<void(const SimpleProgressBar &)>;
 using UEPackagesArray = std::vector<std::pair<uint8_t *const, std::vector<UE_UObject>>>;
 
+struct UEDumperPhaseStats
+{
+    std::string name;
+    double wallMS = 0;
+    UEMemory::ReadStats reads;
+
+    double readsPerSec() const { return wallMS > 0 ? double(reads.calls) * 1000.0 / wallMS : 0; }
+};
+
+// remote reads and wall time of the last Dump() call, per phase in execution order
+struct UEDumperStats
+{
+    std::vector<UEDumperPhaseStats> phases;
+    double totalMS = 0;
+    UEMemory::ReadStats totalReads;
+    UEWrappers::ObjectValidationStats validation;
+    UENameCache::Stats names;
+    UENameArena::Stats nameArena;
+    UEDisplayNameCache::Stats displayNames;
+
+    // page mirror, objects and packages with a changed page since the previous dump
+    UEPageMirror::Stats mirror;
+    size_t changedObjects = 0, changedPackages = 0;
+};
+
 class UEDumper
 {
     IGameProfile const *_profile;
+    UESnapshotFile const *_snapshot;
     std::string _lastError;
     std::function<void(bool)> _dumpExeInfoNotify;
     std::function<void(bool)> _dumpNamesInfoNotify;
@@ -24,18 +52,26 @@ class UEDumper
     std::function<void(bool)> _dumpOffsetsInfoNotify;
     ProgressCallback _objectsProgressCallback;
     ProgressCallback _dumpProgressCallback;
+    UEDumperStats _stats;
+    std::chrono::steady_clock::time_point _phaseStart;
+    UEMemory::ReadStats _phaseReads;
 
 public:
-    UEDumper() : _profile(nullptr), _dumpExeInfoNotify(nullptr), _dumpNamesInfoNotify(nullptr), _dumpObjectsInfoNotify(nullptr), _objectsProgressCallback(nullptr), _dumpProgressCallback(nullptr) {}
+    UEDumper() : _profile(nullptr), _snapshot(nullptr), _dumpExeInfoNotify(nullptr), _dumpNamesInfoNotify(nullptr), _dumpObjectsInfoNotify(nullptr), _objectsProgressCallback(nullptr), _dumpProgressCallback(nullptr) {}
 
     bool Init(IGameProfile *profile);
 
+    // replay dump offline, reads are served from snapshot
+    bool Init(IGameProfile *profile, const UESnapshotFile *snapshot);
+
     bool Dump(std::unordered_map<std::string, BufferFmt> *outBuffersMap);
 
     const IGameProfile *GetProfile() const { return _profile; }
 
     std::string GetLastError() const { return _lastError; }
 
+    const UEDumperStats &GetStats() const { return _stats; }
+
     inline void setDumpExeInfoNotify(const std::function<void(bool)> &f) { _dumpExeInfoNotify = f; }
     inline void setDumpNamesInfoNotify(const std::function<void(bool)> &f) { _dumpNamesInfoNotify = f; }
     inline void setDumpObjectsInfoNotify(const std::function<void(bool)> &f) { _dumpObjectsInfoNotify = f; }
@@ -45,9 +81,16 @@ public:
     inline void setDumpProgressCallback(const ProgressCallback &f) { _dumpProgressCallback = f; }
 
 private:
+    std::vector<KittyMemoryEx::ProcMap> GetUnrealEngineSegments() const;
+
+    void BeginPhase(const std::string &name);
+    void EndPhase();
+
+    void DumpStats(BufferFmt &logsBufferFmt);
+
     void DumpExecutableInfo(BufferFmt &logsBufferFmt);
 
-    void DumpNamesInfo(BufferFmt &logsBufferFmt);
+    void DumpNamesInfo(BufferFmt &logsBufferFmt, BufferFmt &namesBufferFmt);
 
     void DumpObjectsInfo(BufferFmt &logsBufferFmt);
 
@@ -55,5 +98,7 @@ private:
 
     void GatherUObjects(BufferFmt &logsBufferFmt, BufferFmt &objsBufferFmt, UEPackagesArray &packages, const ProgressCallback &progressCallback);
 
+    void CountChangedObjects(const UEPackagesArray &packages);
+
     void DumpAIOHeader(BufferFmt &logsBufferFmt, BufferFmt &aioBufferFmt, UEPackagesArray &packages, const ProgressCallback &progressCallback);
 };
@@ -0,0 +1,303 @@
+#include "UEBenchmark.hpp"
+
+#include <chrono>
+#include <random>
+
+#include <fmt/format.h>
+
+#include "UEGameProfile.hpp"
+#include "UEMemory.hpp"
+using namespace UEMemory;
+
+namespace UEBenchmark
+{
+    namespace
+    {
+        template <typename F>
+        Result measure(const std::string &name, size_t ops, F &&f)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+
+            Result r;
+            r.name = name;
+            r.ops = ops;
+            r.totalMS = std::chrono::duration<double, std::milli>(end - start).count();
+            return r;
+        }
+    }  // namespace
+
+    std::string Result::ToString() const
+    {
+        std::string str = fmt::format("{}: {} ops in {:.2f}ms ({:.1f} ns/op)", name, ops, totalMS, nsPerOp());
+        if (!details.empty())
+            str += fmt::format(" | {}", details);
+        return str;
+    }
+
+    std::vector<Result> RegionLookups(size_t lookups)
+    {
+        std::vector<Result> results;
+
+        const auto ranges = Regions::GetRanges();
+        if (ranges.empty() || lookups == 0)
+            return results;
+
+        std::mt19937_64 rng(0x5EED);
+
+        // 3/4 inside readable regions, rest anywhere in user space
+        std::vector<uintptr_t> randomAddrs(lookups);
+        for (auto &addr : randomAddrs)
+        {
+            if (rng() % 4 == 0)
+            {
+                addr = uintptr_t(rng()) & (sizeof(void *) == 8 ? 0x7FFFFFFFFFF8ull : 0xFFFFFFF8u);
+                continue;
+            }
+
+            const auto &range = ranges[rng() % ranges.size()];
+            addr = range.first + ((rng() % (range.second - range.first)) & ~uintptr_t(7));
+        }
+
+        // pointer chasing reads mostly stay in one region for a while
+        std::vector<uintptr_t> clusteredAddrs(lookups);
+        for (size_t i = 0; i < lookups;)
+        {
+            const auto &range = ranges[rng() % ranges.size()];
+            uintptr_t addr = range.first;
+            for (size_t j = 0; j < 256 && i < lookups; j++, i++)
+            {
+                clusteredAddrs[i] = addr;
+                addr += sizeof(void *);
+                if (addr + sizeof(void *) > range.second)
+                    addr = range.first;
+            }
+        }
+
+        volatile size_t sink = 0;
+
+        auto runIndex = [&](const std::vector<uintptr_t> &addrs)
+        {
+            size_t n = 0;
+            for (uintptr_t addr : addrs)
+                n += Regions::IsReadable(addr, sizeof(void *));
+            sink = sink + n;
+        };
+
+        auto runValidator = [&](const std::vector<uintptr_t> &addrs)
+        {
+            size_t n = 0;
+            for (uintptr_t addr : addrs)
+                n += PtrValidator.isPtrReadable(addr, sizeof(void *));
+            sink = sink + n;
+        };
+
+        results.push_back(measure("Regions Index (random)", lookups, [&] { runIndex(randomAddrs); }));
+        results.push_back(measure("Regions Index (clustered)", lookups, [&] { runIndex(clusteredAddrs); }));
+        results.push_back(measure("PtrValidator (random)", lookups, [&] { runValidator(randomAddrs); }));
+        results.push_back(measure("PtrValidator (clustered)", lookups, [&] { runValidator(clusteredAddrs); }));
+
+        return results;
+    }
+
+    std::vector<Result> ReplayTrace(const std::string &path)
+    {
+        std::vector<Result> results;
+
+        UEReadTrace::Reader reader;
+        if (!reader.Open(path))
+            return results;
+
+        struct Strategy
+        {
+            std::string name;
+            bool cache;
+            size_t maxPages;
+        };
+
+        const Strategy strategies[] = {
+            {"Trace Replay (no cache)", false, 0},
+            {"Trace Replay (cache 1024 pages)", true, 1024},
+            {"Trace Replay (cache default)", true, PageCache::kDefaultMaxPages},
+            {"Trace Replay (cache unlimited)", true, 0},
+        };
+
+        const bool wasCached = PageCache::IsEnabled();
+        const size_t prevMaxPages = PageCache::GetStats().maxPages;
+        std::vector<uint8_t> buffer;
+
+        for (const auto &strategy : strategies)
+        {
+            if (strategy.cache)
+                PageCache::Enable(strategy.maxPages);
+            else
+                PageCache::Disable();
+
+            reader.Rewind();
+            const ReadStats readsBefore = GetReadStats();
+
+            size_t reads = 0, mismatches = 0;
+            UEReadTrace::Record record{};
+            Result r = measure(strategy.name, 0, [&]
+            {
+                while (reader.Next(&record))
+                {
+                    if (buffer.size() < record.len)
+                        buffer.resize(record.len);
+
+                    const bool ok = vm_rpm_ptr((const void *)record.address, buffer.data(), record.len);
+                    if (ok != record.ok || (ok && UEReadTrace::Hash(buffer.data(), record.len) != record.hash))
+                        mismatches++;
+
+                    reads++;
+                }
+            });
+
+            const ReadStats readStats = GetReadStats() - readsBefore;
+            r.ops = reads;
+            r.details = fmt::format("target reads {} | mismatches {}", readStats.targetReads, mismatches);
+            if (strategy.cache)
+            {
+                auto cacheStats = PageCache::GetStats();
+                r.details += fmt::format(" | hits {} | misses {} | evictions {}", cacheStats.hits, cacheStats.misses, cacheStats.evictions);
+            }
+            results.push_back(r);
+        }
+
+        if (wasCached)
+            PageCache::Enable(prevMaxPages);
+        else
+            PageCache::Disable();
+
+        return results;
+    }
+
+    std::vector<Result> NameDecryption(const IGameProfile *profile, size_t names)
+    {
+        std::vector<Result> results;
+        if (!profile || names == 0)
+            return results;
+
+        std::mt19937 rng(0x5EED);
+
+        // identifier like names, most UE names are short
+        std::vector<std::string> source(names);
+        size_t bytes = 0;
+        for (auto &name : source)
+        {
+            const size_t len = 4 + (rng() % 8 == 0 ? rng() % 96 : rng() % 28);
+            name.resize(len);
+            for (auto &c : name)
+                c = char('A' + rng() % 58);
+            bytes += len;
+        }
+
+        std::vector<std::string> work = source;
+        results.push_back(measure("Name Decryption (per name)", names, [&]
+        {
+            for (auto &name : work)
+                profile->DecryptNames(&name, 1);
+        }));
+
+        work = source;
+        results.push_back(measure("Name Decryption (batched)", names, [&]
+        {
+            profile->DecryptNames(work.data(), work.size());
+        }));
+
+        for (auto &result : results)
+            result.details = fmt::format("{} bytes, {:.2f} ns/byte", bytes, result.totalMS * 1000000.0 / double(bytes));
+
+        return results;
+    }
+
+    std::vector<Result> NameHeaders(const IGameProfile *profile, size_t headers)
+    {
+        std::vector<Result> results;
+        const UE_Offsets *offsets = profile ? profile->GetOffsets() : nullptr;
+        if (!offsets || headers == 0)
+            return results;
+
+        std::mt19937 rng(0x5EED);
+
+        // keeps decoded values alive
+        volatile size_t sink = 0;
+
+        if (!profile->IsUsingFNamePool())
+        {
+            const auto &entry = offsets->FNameEntry;
+            if (!entry.GetIsWide)
+                return results;
+
+            std::vector<int32_t> indices(headers);
+            for (auto &index : indices)
+                index = int32_t(rng());
+
+            results.push_back(measure("GNames Wide Flag (std::function)", headers, [&]
+            {
+                size_t wide = 0;
+                for (int32_t index : indices)
+                    wide += entry.GetIsWide(index);
+                sink = wide;
+            }));
+
+            results.push_back(measure("GNames Wide Flag (decoder)", headers, [&]
+            {
+                sink = UENameHeaders::DispatchGNames(entry, [&](auto header)
+                {
+                    size_t wide = 0;
+                    for (int32_t index : indices)
+                        wide += header.IsWide(index);
+                    return wide;
+                });
+            }));
+            return results;
+        }
+
+        const auto &entry = offsets->FNamePoolEntry;
+        if (!entry.GetLength || !entry.GetIsWide)
+            return results;
+
+        std::vector<uint16_t> values(headers);
+        for (auto &value : values)
+            value = uint16_t(rng());
+
+        results.push_back(measure("Name Pool Header (std::function)", headers, [&]
+        {
+            size_t total = 0;
+            for (uint16_t value : values)
+                total += entry.GetLength(value) + entry.GetIsWide(value);
+            sink = total;
+        }));
+
+        results.push_back(measure("Name Pool Header (decoder)", headers, [&]
+        {
+            sink = UENameHeaders::DispatchNamePool(entry, profile->isUsingOutlineNumberName(), [&](auto header)
+            {
+                size_t total = 0;
+                for (uint16_t value : values)
+                    total += header.Length(value) + header.IsWide(value);
+                return total;
+            });
+        }));
+
+        return results;
+    }
+
+    std::vector<Result> RunAll(const IGameProfile *profile)
+    {
+        std::vector<Result> results;
+
+        auto regions = RegionLookups();
+        results.insert(results.end(), regions.begin(), regions.end());
+
+        auto names = NameDecryption(profile);
+        results.insert(results.end(), names.begin(), names.end());
+
+        auto headers = NameHeaders(profile);
+        results.insert(results.end(), headers.begin(), headers.end());
+
+        return results;
+    }
+}  // namespace UEBenchmark
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class IGameProfile;
+
+// Micro benchmarks for the memory hot paths, run against the initialized target
+namespace UEBenchmark
+{
+    struct Result
+    {
+        std::string name;
+        size_t ops = 0;
+        double totalMS = 0;
+        std::string details;
+
+        double nsPerOp() const { return ops ? (totalMS * 1000000.0) / double(ops) : 0; }
+        std::string ToString() const;
+    };
+
+    // readable regions index vs PtrValidator, random and clustered address workloads
+    std::vector<Result> RegionLookups(size_t lookups = 1000000);
+
+    // replays a UEReadTrace against the active memory backend with different cache setups
+    // reads returning different data than recorded are reported as mismatches
+    std::vector<Result> ReplayTrace(const std::string &path);
+
+    // profile name decryption hook on generated names, called once per name and once for all of them
+    std::vector<Result> NameDecryption(const IGameProfile *profile, size_t names = 200000);
+
+    // name entry header decoding through the offsets std::function members vs the compile-time decoder of the profile layout
+    std::vector<Result> NameHeaders(const IGameProfile *profile, size_t headers = 1000000);
+
+    // profile benchmarks are skipped when profile is nullptr
+    std::vector<Result> RunAll(const IGameProfile *profile = nullptr);
+}  // namespace UEBenchmark
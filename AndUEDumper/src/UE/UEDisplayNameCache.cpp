@@ -0,0 +1,47 @@
+#include "UEDisplayNameCache.hpp"
+
+#include <mutex>
+
+bool UEDisplayNameCache::Get(int32_t index, int32_t number, std::string_view *out)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+
+        auto it = _names.find(makeKey(index, number));
+        if (it != _names.end())
+        {
+            *out = it->second;
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    _misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void UEDisplayNameCache::Put(int32_t index, int32_t number, std::string_view name)
+{
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    _names.emplace(makeKey(index, number), name);
+}
+
+void UEDisplayNameCache::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    _names.clear();
+    _hits = 0;
+    _misses = 0;
+}
+
+UEDisplayNameCache::Stats UEDisplayNameCache::GetStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+
+    Stats stats;
+    stats.hits = _hits.load(std::memory_order_relaxed);
+    stats.misses = _misses.load(std::memory_order_relaxed);
+    stats.names = _names.size();
+    return stats;
+}
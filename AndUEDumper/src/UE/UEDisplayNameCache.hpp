@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+// Final display names keyed by FName (ComparisonIndex, Number), with the number suffix and path stripping applied.
+// Views point into the name arena, so the cache is cleared along with it.
+// Thread safe, lookups share the lock.
+class UEDisplayNameCache
+{
+public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t names = 0;
+
+        double hitRate() const { return (hits + misses) ? double(hits) * 100.0 / double(hits + misses) : 0; }
+    };
+
+private:
+    std::unordered_map<uint64_t, std::string_view> _names;
+
+    std::atomic<uint64_t> _hits, _misses;
+    mutable std::shared_mutex _mutex;
+
+    static uint64_t makeKey(int32_t index, int32_t number) { return (uint64_t(uint32_t(index)) << 32) | uint32_t(number); }
+
+public:
+    UEDisplayNameCache() : _hits(0), _misses(0) {}
+
+    UEDisplayNameCache(const UEDisplayNameCache &) = delete;
+    UEDisplayNameCache &operator=(const UEDisplayNameCache &) = delete;
+
+    bool Get(int32_t index, int32_t number, std::string_view *out);
+    void Put(int32_t index, int32_t number, std::string_view name);
+
+    void Clear();
+
+    Stats GetStats() const;
+};
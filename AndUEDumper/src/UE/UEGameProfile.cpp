@@ -1,10 +1,21 @@
 #include "UEGameProfile.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "../Utils/UTFUtils.hpp"
+
 #include "UEMemory.hpp"
+#include "UESnapshot.hpp"
 #include "UEWrappers.hpp"
 
 using namespace UEMemory;
 
+// TNameEntryArray { FNameEntry **Chunks[kGNamesMaxChunks]; int32 NumElements; int32 NumChunks; }
+static constexpr int32_t kGNamesElementsPerChunk = 16384;
+static constexpr int32_t kGNamesMaxChunks = 128;
+
 UEVarsInitStatus IGameProfile::InitUEVars()
 {
     bool is32Bit = KittyMemoryEx::getMapsEndWith(kMgr.processID(), "/linker64").empty();
@@ -44,6 +55,9 @@ UEVarsInitStatus IGameProfile::InitUEVars()
     if (PtrValidator.regions().empty())
         return UEVarsInitStatus::ERROR_INIT_PTR_VALIDATOR;
 
+    if (!Regions::Refresh(kMgr.processID()))
+        LOGW("Couldn't build readable regions index, using PtrValidator.");
+
     _UEVars.BaseAddress = ue_elf.base();
 
     UE_Offsets *pOffsets = GetOffsets();
@@ -53,6 +67,7 @@ UEVarsInitStatus IGameProfile::InitUEVars()
     _UEVars.Offsets = pOffsets;
 
     _UEVars.NamesPtr = GetNamesPtr();
+    _UEVars.GNamesArrayPtr = 0;
     if (IsUsingFNamePool())
     {
         if (!PtrValidator.isPtrReadable(_UEVars.NamesPtr))
@@ -62,6 +77,10 @@ UEVarsInitStatus IGameProfile::InitUEVars()
     {
         if (!PtrValidator.isPtrReadable(_UEVars.NamesPtr))
             return UEVarsInitStatus::ERROR_INIT_GNAMES;
+
+        _UEVars.GNamesArrayPtr = vm_rpm_ptr<uintptr_t>((void *)_UEVars.NamesPtr);
+        if (_UEVars.GNamesArrayPtr == 0)
+            return UEVarsInitStatus::ERROR_INIT_GNAMES;
     }
 
     _UEVars.pGetNameByID = [this](int32_t id) -> std::string
@@ -69,6 +88,9 @@ UEVarsInitStatus IGameProfile::InitUEVars()
         return GetNameByID(id);
     };
 
+    _UEVars.NamesCache = std::make_shared<UENameCache>();
+    _UEVars.NamesCache->Reserve(GetNamesCapacity());
+
     _UEVars.GUObjectsArrayPtr = GetGUObjectArrayPtr();
       LOGE("GUObjectArray:0x%X", _UEVars.GUObjectsArrayPtr- _UEVars.BaseAddress);
     if (!PtrValidator.isPtrReadable(_UEVars.GUObjectsArrayPtr))
@@ -85,6 +107,58 @@ UEVarsInitStatus IGameProfile::InitUEVars()
     return UEVarsInitStatus::SUCCESS;
 }
 
+UEVarsInitStatus IGameProfile::InitUEVars(const UESnapshotFile &snapshot)
+{
+    if (!snapshot.IsOpen() || UEMemory::GetBackend() != &snapshot)
+        return UEVarsInitStatus::ERROR_INIT_SNAPSHOT;
+
+    const auto &header = snapshot.GetHeader();
+    if (header.pointerSize != sizeof(void *))
+    {
+        LOGE("Dumper is %dbit while snapshot is %dbit. Please use the correct architecture.", int(sizeof(void *) * 8), int(header.pointerSize * 8));
+        return UEVarsInitStatus::ERROR_ARCH_MISMATCH;
+    }
+
+    _UEVars.BaseAddress = header.BaseAddress;
+
+    UE_Offsets *pOffsets = GetOffsets();
+    if (!pOffsets)
+        return UEVarsInitStatus::ERROR_INIT_OFFSETS;
+
+    _UEVars.Offsets = pOffsets;
+
+    _UEVars.NamesPtr = header.NamesPtr;
+    if (!IsPtrReadable(_UEVars.NamesPtr))
+        return IsUsingFNamePool() ? UEVarsInitStatus::ERROR_INIT_NAMEPOOL : UEVarsInitStatus::ERROR_INIT_GNAMES;
+
+    _UEVars.GNamesArrayPtr = 0;
+    if (!IsUsingFNamePool())
+    {
+        _UEVars.GNamesArrayPtr = vm_rpm_ptr<uintptr_t>((void *)_UEVars.NamesPtr);
+        if (_UEVars.GNamesArrayPtr == 0)
+            return UEVarsInitStatus::ERROR_INIT_GNAMES;
+    }
+
+    _UEVars.pGetNameByID = [this](int32_t id) -> std::string
+    {
+        return GetNameByID(id);
+    };
+
+    _UEVars.NamesCache = std::make_shared<UENameCache>();
+    _UEVars.NamesCache->Reserve(GetNamesCapacity());
+
+    _UEVars.GUObjectsArrayPtr = header.GUObjectsArrayPtr;
+    if (!IsPtrReadable(_UEVars.GUObjectsArrayPtr))
+        return UEVarsInitStatus::ERROR_INIT_GUOBJECTARRAY;
+
+    _UEVars.ObjObjectsPtr = header.ObjObjectsPtr;
+    _UEVars.ObjObjects_Objects = header.ObjObjects_Objects;
+
+    UEWrappers::Init(GetUEVars());
+
+    return UEVarsInitStatus::SUCCESS;
+}
+
 uint8_t *IGameProfile::GetNameEntry(int32_t id) const
 {
     if (id < 0)
@@ -96,15 +170,12 @@ uint8_t *IGameProfile::GetNameEntry(int32_t id) const
 
     if (!IsUsingFNamePool())
     {
-        static uintptr_t gNames = 0;
+        const uintptr_t gNames = _UEVars.GetGNamesArrayPtr();
         if (gNames == 0)
-        {
-            gNames = vm_rpm_ptr<uintptr_t>((void *)namesPtr);
-        }
+            return nullptr;
 
-        const int32_t ElementsPerChunk = 16384;
-        const int32_t ChunkIndex = id / ElementsPerChunk;
-        const int32_t WithinChunkIndex = id % ElementsPerChunk;
+        const int32_t ChunkIndex = id / kGNamesElementsPerChunk;
+        const int32_t WithinChunkIndex = id % kGNamesElementsPerChunk;
 
         // FNameEntry**
         uint8_t *FNameEntryArray = vm_rpm_ptr<uint8_t *>((void *)(gNames + ChunkIndex * sizeof(uintptr_t)));
@@ -138,8 +209,7 @@ std::string IGameProfile::GetNameEntryString(uint8_t *entry) const
     UE_Offsets *offsets = GetOffsets();
 
     uint8_t *pStr = nullptr;
-    // don't care for now
-    // bool isWide = false;
+    bool isWide = false;
     size_t strLen = 0;
     int strNumber = 0;
 
@@ -151,7 +221,10 @@ std::string IGameProfile::GetNameEntryString(uint8_t *entry) const
             return "";
 
         pStr = entry + offsets->FNameEntry.Name;
-        // isWide = offsets->FNameEntry.GetIsWide(name_index)
+        isWide = UENameHeaders::DispatchGNames(offsets->FNameEntry, [name_index](auto header)
+        {
+            return header.IsWide(name_index);
+        });
         strLen = kMAX_UENAME_BUFFER;
     }
     else
@@ -161,32 +234,44 @@ std::string IGameProfile::GetNameEntryString(uint8_t *entry) const
                         sizeof(int16_t)))
             return "";
 
-        if (isUsingOutlineNumberName() &&
-            offsets->FNamePoolEntry.GetLength(header) == 0)
+        // length and wide flag of the header, outline number entries have length 0
+        auto decodeHeader = [offsets, this](uint16_t header, bool *wide) -> size_t
+        {
+            return UENameHeaders::DispatchNamePool(offsets->FNamePoolEntry, isUsingOutlineNumberName(), [header, wide](auto decoder)
+            {
+                *wide = decoder.IsWide(header);
+                return decoder.Length(header);
+            });
+        };
+
+        if (isUsingOutlineNumberName() && decodeHeader(header, &isWide) == 0)
         {
             const uintptr_t stringOff =
                 offsets->FNamePoolEntry.Header + sizeof(int16_t);
             const uintptr_t entryIdOff = stringOff + ((stringOff == 6) * 2);
-            const int32_t nextEntryId = vm_rpm_ptr<int32_t>(entry + entryIdOff);
-            if (nextEntryId <= 0)
+
+            // next entry id and number
+            int32_t next[2] = {};
+            if (!vm_rpm_ptr(entry + entryIdOff, next, sizeof(next)) || next[0] <= 0)
                 return "";
 
-            strNumber = vm_rpm_ptr<int32_t>(entry + entryIdOff + sizeof(int32_t));
+            const int32_t nextEntryId = next[0];
+            strNumber = next[1];
             entry = GetNameEntry(nextEntryId);
             if (!vm_rpm_ptr(entry + offsets->FNamePoolEntry.Header, &header,
                             sizeof(int16_t)))
                 return "";
         }
 
-        strLen = std::min<size_t>(offsets->FNamePoolEntry.GetLength(header), kMAX_UENAME_BUFFER);
+        strLen = std::min<size_t>(decodeHeader(header, &isWide), kMAX_UENAME_BUFFER);
         if (strLen <= 0)
             return "";
 
-        // isWide = offsets->FNamePoolEntry.GetIsWide(header);
         pStr = entry + offsets->FNamePoolEntry.Header + sizeof(int16_t);
     }
 
-    std::string result = vm_rpm_str(pStr, strLen);
+    std::string result = isWide ? UTFUtils::UTF16ToUTF8(vm_rpm_str16(pStr, strLen)) : vm_rpm_str(pStr, strLen);
+    DecryptNames(&result, 1);
 
     if (strNumber > 0)
         result += '_' + std::to_string(strNumber - 1);
@@ -199,6 +284,398 @@ std::string IGameProfile::GetNameByID(int32_t id) const
     return GetNameEntryString(GetNameEntry(id));
 }
 
+size_t IGameProfile::GetNamesCapacity() const
+{
+    uintptr_t namesPtr = _UEVars.GetNamesPtr();
+    if (namesPtr == 0)
+        return 0;
+
+    if (!IsUsingFNamePool())
+    {
+        const uintptr_t gNames = _UEVars.GetGNamesArrayPtr();
+        int32_t counts[2] = {};  // NumElements, NumChunks
+        if (!gNames || !vm_rpm_ptr((void *)(gNames + kGNamesMaxChunks * sizeof(void *)), counts, sizeof(counts)))
+            return 0;
+
+        if (counts[1] <= 0 || counts[1] > kGNamesMaxChunks || counts[0] <= 0 || counts[0] > counts[1] * kGNamesElementsPerChunk)
+            return 0;
+
+        return size_t(counts[0]);
+    }
+
+    // FNameEntryAllocator { FRWLock Lock; uint32 CurrentBlock; uint32 CurrentByteCursor; FNameEntryHandle Blocks[]; }
+    const auto &pool = GetOffsets()->FNamePool;
+    if (pool.BlocksOff < sizeof(uint32_t) * 2 || pool.BlocksBit == 0 || pool.BlocksBit >= 32)
+        return 0;
+
+    constexpr uint32_t kMaxNameBlocks = 8192;
+    // bounds the names cache slots, a pool past it most likely comes from garbage allocator fields
+    constexpr size_t kMaxCapacity = UENameCache::kMaxSlots;
+
+    uint32_t currentBlock = 0;
+    if (!vm_rpm_ptr((void *)(namesPtr + pool.BlocksOff - sizeof(uint32_t) * 2), &currentBlock, sizeof(uint32_t)) || currentBlock >= kMaxNameBlocks)
+        return 0;
+
+    // layouts that moved the allocator fields read garbage, the current block must be allocated
+    if (!vm_rpm_ptr<uintptr_t>((void *)(namesPtr + pool.BlocksOff + currentBlock * sizeof(void *))))
+        return 0;
+
+    const size_t capacity = size_t(currentBlock + 1) << pool.BlocksBit;
+    return capacity <= kMaxCapacity ? capacity : 0;
+}
+
+size_t IGameProfile::LoadNames(const NameCallback &callback) const
+{
+    if (_UEVars.GetNamesPtr() == 0)
+        return 0;
+
+    return IsUsingFNamePool() ? LoadNamePool(callback) : LoadGNames(callback);
+}
+
+size_t IGameProfile::LoadNamePool(const NameCallback &callback) const
+{
+    const uintptr_t namesPtr = _UEVars.GetNamesPtr();
+    const UE_Offsets *offsets = GetOffsets();
+    const auto &pool = offsets->FNamePool;
+    const auto &poolEntry = offsets->FNamePoolEntry;
+
+    if ((poolEntry.Layout == UENameEntryLayout::Custom && !poolEntry.GetLength) || pool.Stride == 0 || pool.BlocksOff < sizeof(uint32_t) * 2)
+        return 0;
+
+    const size_t capacity = GetNamesCapacity();
+    if (capacity == 0)
+        return 0;
+
+    // CurrentBlock, CurrentByteCursor
+    uint32_t allocator[2] = {};
+    if (!vm_rpm_ptr((void *)(namesPtr + pool.BlocksOff - sizeof(allocator)), allocator, sizeof(allocator)))
+        return 0;
+
+    const size_t blocksCount = capacity >> pool.BlocksBit;
+    const size_t blockSize = (size_t(1) << pool.BlocksBit) * pool.Stride;
+
+    std::vector<uintptr_t> blocks(blocksCount);
+    if (!vm_rpm_ptr((void *)(namesPtr + pool.BlocksOff), blocks.data(), blocks.size() * sizeof(uintptr_t)))
+        return 0;
+
+    const uintptr_t headerOff = poolEntry.Header;
+    const uintptr_t stringOff = headerOff + sizeof(uint16_t);
+    // outline number entries: header with length 0, then next entry id and number
+    const uintptr_t entryIdOff = stringOff + ((stringOff == 6) * 2);
+
+    struct OutlineName
+    {
+        size_t index;  // in block names
+        int32_t baseId;
+        int32_t number;
+    };
+
+    // names[i] is the name of ids[i], outline names are empty until resolved
+    struct BlockNames
+    {
+        std::vector<int32_t> ids;
+        std::vector<std::string> names;
+        std::vector<OutlineName> outlines;
+    };
+
+    std::vector<BlockNames> results(blocksCount);
+    // every allocated block read whole, the cache then holds the entire table
+    std::atomic<bool> complete{true};
+
+    // header decoding inlined in the walker, one instance per layout
+    UENameHeaders::DispatchNamePool(poolEntry, isUsingOutlineNumberName(), [&](auto header)
+    {
+        ReadExecutor::Run(blocksCount, [&](size_t block)
+        {
+            if (!blocks[block])
+            {
+                complete = false;
+                return;
+            }
+
+            // current block is only filled up to the cursor
+            size_t blockBytes = blockSize;
+            if (block == blocksCount - 1 && allocator[0] == block && allocator[1] <= blockSize)
+                blockBytes = allocator[1];
+
+            std::vector<uint8_t> data(blockBytes);
+            size_t dataSize = 0;
+            while (dataSize < blockBytes)
+            {
+                const size_t len = std::min(blockBytes - dataSize, MemOps::kBulkReadSize);
+                if (!vm_rpm_ptr((void *)(blocks[block] + dataSize), data.data() + dataSize, len))
+                    break;
+
+                dataSize += len;
+            }
+            if (dataSize < blockBytes)
+                complete = false;
+
+            auto &result = results[block];
+            size_t offset = 0;
+            while (offset + stringOff <= dataSize)
+            {
+                const uint8_t *entry = data.data() + offset;
+                const int32_t id = int32_t((block << pool.BlocksBit) | (offset / pool.Stride));
+
+                uint16_t entryHeader = 0;
+                memcpy(&entryHeader, entry + headerOff, sizeof(entryHeader));
+
+                size_t entrySize = 0;
+                const size_t len = header.Length(entryHeader);
+                if (len == 0)
+                {
+                    // zeroed memory past the last entry
+                    if (!header.HasOutlineNumbers() || offset + entryIdOff + sizeof(int32_t) * 2 > dataSize)
+                        break;
+
+                    OutlineName outline{};
+                    memcpy(&outline.baseId, entry + entryIdOff, sizeof(int32_t));
+                    memcpy(&outline.number, entry + entryIdOff + sizeof(int32_t), sizeof(int32_t));
+                    if (outline.baseId <= 0)
+                        break;
+
+                    outline.index = result.names.size();
+                    result.outlines.push_back(outline);
+                    result.ids.push_back(id);
+                    result.names.emplace_back();
+                    entrySize = entryIdOff + sizeof(int32_t) * 2;
+                }
+                else
+                {
+                    const bool isWide = header.IsWide(entryHeader);
+                    entrySize = stringOff + len * (isWide ? sizeof(char16_t) : sizeof(char));
+                    if (offset + entrySize > dataSize)
+                        break;
+
+                    // same limit as GetNameEntryString
+                    const size_t strLen = std::min<size_t>(len, kMAX_UENAME_BUFFER);
+                    const uint8_t *str = entry + stringOff;
+
+                    std::string name;
+                    if (isWide)
+                    {
+                        std::u16string wstr(strLen, u'\0');
+                        memcpy(&wstr[0], str, strLen * sizeof(char16_t));
+                        name = UTFUtils::UTF16ToUTF8(wstr.c_str(), std::char_traits<char16_t>::length(wstr.c_str()));
+                    }
+                    else
+                    {
+                        name.assign(reinterpret_cast<const char *>(str), strnlen(reinterpret_cast<const char *>(str), strLen));
+                    }
+
+                    result.ids.push_back(id);
+                    result.names.push_back(std::move(name));
+                }
+
+                offset += (entrySize + pool.Stride - 1) / pool.Stride * pool.Stride;
+            }
+
+            DecryptNames(result.names.data(), result.names.size());
+        });
+    });
+
+    UENameCache *cache = _UEVars.NamesCache.get();
+
+    size_t count = 0;
+    for (auto &result : results)
+    {
+        for (size_t i = 0; i < result.names.size(); i++)
+        {
+            if (!result.names[i].empty() && cache)
+                cache->Put(result.ids[i], result.names[i]);
+        }
+    }
+
+    // outline names point to entries of any block
+    for (auto &result : results)
+    {
+        for (const auto &outline : result.outlines)
+        {
+            std::string name = _UEVars.GetNameByID(outline.baseId);
+            if (!name.empty() && outline.number > 0)
+                name += '_' + std::to_string(outline.number - 1);
+
+            result.names[outline.index] = std::move(name);
+            if (!result.names[outline.index].empty() && cache)
+                cache->Put(result.ids[outline.index], result.names[outline.index]);
+        }
+
+        for (size_t i = 0; i < result.names.size(); i++)
+        {
+            if (result.names[i].empty())
+                continue;
+
+            count++;
+            if (callback)
+                callback(result.ids[i], result.names[i]);
+        }
+    }
+
+    if (complete && count > 0 && cache)
+        cache->BuildIndex();
+
+    return count;
+}
+
+size_t IGameProfile::LoadGNames(const NameCallback &callback) const
+{
+    const UE_Offsets *offsets = GetOffsets();
+    const auto &nameEntry = offsets->FNameEntry;
+
+    // NumElements, validated against NumChunks
+    const size_t elementsCount = GetNamesCapacity();
+    if (elementsCount == 0)
+        return 0;
+
+    const uintptr_t gNames = _UEVars.GetGNamesArrayPtr();
+    const size_t chunksCount = (elementsCount + kGNamesElementsPerChunk - 1) / kGNamesElementsPerChunk;
+
+    std::vector<uintptr_t> chunks(chunksCount);
+    if (!gNames || !vm_rpm_ptr((void *)gNames, chunks.data(), chunks.size() * sizeof(uintptr_t)))
+        return 0;
+
+    // index and string of each entry in one read, entries have no length so the span covers short names only
+    // and longer ones are read on their own, wide names take 2 bytes per character
+    constexpr size_t kSpanNameBytes = 0x80;
+    constexpr size_t kSpanNameChars16 = kSpanNameBytes / sizeof(char16_t);
+    const uintptr_t spanStart = std::min(nameEntry.Index, nameEntry.Name);
+    const size_t nameOff = nameEntry.Name - spanStart;
+    const size_t indexOff = nameEntry.Index - spanStart;
+    const size_t spanSize = std::max(nameOff + kSpanNameBytes, indexOff + sizeof(int32_t));
+
+    constexpr size_t kEntriesBatchSize = 1024;
+
+    std::vector<std::vector<std::string>> results(chunksCount);
+    // every chunk read, the cache then holds the entire table
+    std::atomic<bool> complete{true};
+
+    // wide flag decoding inlined in the walker, one instance per layout
+    UENameHeaders::DispatchGNames(nameEntry, [&](auto header)
+    {
+        ReadExecutor::Run(chunksCount, [&](size_t chunk)
+        {
+            if (!chunks[chunk])
+            {
+                complete = false;
+                return;
+            }
+
+            const size_t first = chunk * kGNamesElementsPerChunk;
+            const size_t count = std::min<size_t>(kGNamesElementsPerChunk, elementsCount - first);
+
+            std::vector<uintptr_t> entries(count);
+            if (!vm_rpm_ptr((void *)chunks[chunk], entries.data(), entries.size() * sizeof(uintptr_t)))
+            {
+                complete = false;
+                return;
+            }
+
+            auto &names = results[chunk];
+            names.resize(count);
+
+            std::vector<uint8_t> spans(kEntriesBatchSize * spanSize);
+            std::vector<ReadRequest> requests;
+            requests.reserve(kEntriesBatchSize);
+
+            // entries read on their own come back decrypted, they are filled after the chunk is decrypted
+            // these are spans that couldn't be read and names longer than the span
+            std::vector<size_t> unreadEntries;
+
+            for (size_t batchStart = 0; batchStart < count; batchStart += kEntriesBatchSize)
+            {
+                const size_t batchCount = std::min(kEntriesBatchSize, count - batchStart);
+
+                requests.clear();
+                for (size_t i = 0; i < batchCount; i++)
+                {
+                    const uintptr_t entry = entries[batchStart + i];
+                    requests.push_back({entry ? (const void *)(entry + spanStart) : nullptr, spans.data() + i * spanSize, spanSize});
+                }
+                vm_rpm_batch(requests);
+
+                for (size_t i = 0; i < batchCount; i++)
+                {
+                    const uintptr_t entry = entries[batchStart + i];
+                    if (!entry)
+                        continue;
+
+                    // span runs past the end of readable memory, read this one on its own
+                    if (!requests[i].success)
+                    {
+                        unreadEntries.push_back(batchStart + i);
+                        continue;
+                    }
+
+                    const uint8_t *span = spans.data() + i * spanSize;
+
+                    int32_t nameIndex = 0;
+                    memcpy(&nameIndex, span + indexOff, sizeof(nameIndex));
+
+                    std::string name;
+                    if (header.IsWide(nameIndex))
+                    {
+                        // converted up to the terminator found in the span, names without one are read on their own
+                        char16_t wstr[kSpanNameChars16];
+                        memcpy(wstr, span + nameOff, kSpanNameBytes);
+                        const size_t len = std::find(wstr, wstr + kSpanNameChars16, u'\0') - wstr;
+                        if (len == kSpanNameChars16)
+                        {
+                            unreadEntries.push_back(batchStart + i);
+                            continue;
+                        }
+                        name = UTFUtils::UTF16ToUTF8(wstr, len);
+                    }
+                    else
+                    {
+                        const char *str = reinterpret_cast<const char *>(span + nameOff);
+                        const size_t len = strnlen(str, kSpanNameBytes);
+                        if (len == kSpanNameBytes)
+                        {
+                            unreadEntries.push_back(batchStart + i);
+                            continue;
+                        }
+                        name.assign(str, len);
+                    }
+
+                    names[batchStart + i] = std::move(name);
+                }
+            }
+
+            DecryptNames(names.data(), names.size());
+
+            for (size_t i : unreadEntries)
+                names[i] = GetNameEntryString((uint8_t *)entries[i]);
+        });
+    });
+
+    UENameCache *cache = _UEVars.NamesCache.get();
+
+    size_t count = 0;
+    for (size_t chunk = 0; chunk < chunksCount; chunk++)
+    {
+        const auto &names = results[chunk];
+        for (size_t i = 0; i < names.size(); i++)
+        {
+            if (names[i].empty())
+                continue;
+
+            const int32_t id = int32_t(chunk * kGNamesElementsPerChunk + i);
+            if (cache)
+                cache->Put(id, names[i]);
+
+            count++;
+            if (callback)
+                callback(id, names[i]);
+        }
+    }
+
+    if (complete && count > 0 && cache)
+        cache->BuildIndex();
+
+    return count;
+}
+
 ElfScanner IGameProfile::GetUnrealEngineELF() const
 {
     static const std::vector<std::string> cUELibNames = {"libUE4.so",
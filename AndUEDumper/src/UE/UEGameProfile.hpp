@@ -32,6 +32,8 @@ public:
     virtual ~IGameProfile() = default;
 
     UEVarsInitStatus InitUEVars();
+    // init from snapshot vars, snapshot must be set as UEMemory backend
+    UEVarsInitStatus InitUEVars(const class UESnapshotFile &snapshot);
     const UEVars *GetUEVars() const { return &_UEVars; }
 
     virtual ElfScanner GetUnrealEngineELF() const;
@@ -51,6 +53,20 @@ public:
 
     virtual UE_Offsets *GetOffsets() const = 0;
 
+    using NameCallback = std::function<void(int32_t id, const std::string &name)>;
+
+    // reads the whole names table in bulk and fills the names cache, callback gets every name in id order
+    // returns names count, 0 if the table couldn't be walked
+    size_t LoadNames(const NameCallback &callback = nullptr) const;
+
+    // decrypts name strings read from the names table in place, bulk loaders pass a whole block at once
+    // empty strings must be left as they are, can override if decryption is needed
+    virtual void DecryptNames(std::string *names, size_t count) const
+    {
+        (void)names;
+        (void)count;
+    }
+
 protected:
     virtual uintptr_t GetGUObjectArrayPtr() const = 0;
 
@@ -58,10 +74,18 @@ protected:
     virtual uintptr_t GetNamesPtr() const = 0;
 
     virtual uint8_t *GetNameEntry(int32_t id) const;
-    // can override if decryption is needed
     virtual std::string GetNameEntryString(uint8_t *entry) const;
     virtual std::string GetNameByID(int32_t id) const;
 
+    // name ids the names table can hold right now, sizes the names cache, 0 if unknown
+    size_t GetNamesCapacity() const;
+
+    // walks FNamePool blocks in bulk reads and parses the entries locally
+    size_t LoadNamePool(const NameCallback &callback) const;
+
+    // reads GNames chunk pointer arrays whole and the entries of each chunk in batches
+    size_t LoadGNames(const NameCallback &callback) const;
+
     virtual bool isEmulator() const;
 
     virtual uintptr_t findIdaPattern(PATTERN_MAP_TYPE map_type,
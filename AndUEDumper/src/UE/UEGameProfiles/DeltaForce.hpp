@@ -1,5 +1,13 @@
 #pragma once
 
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "../UEGameProfile.hpp"
 using namespace UEMemory;
 
@@ -120,57 +128,90 @@ public:
         return &offsets;
     }
 
-    std::string GetNameEntryString(uint8_t *entry) const override
+    // name bytes are xor'ed with 0xFF or 0x7F depending on the name length
+    static uint8_t GetNameXorMask(uint32_t len)
+    {
+        uint32_t key = 0;
+        switch (len % 9)
+        {
+        case 0u:
+            key = ((len & 0x1F) + len);
+            break;
+        case 1u:
+            key = ((len ^ 0xDF) + len);
+            break;
+        case 2u:
+            key = ((len | 0xCF) + len);
+            break;
+        case 3u:
+            key = (33 * len);
+            break;
+        case 4u:
+            key = (len + (len >> 2));
+            break;
+        case 5u:
+            key = (3 * len + 5);
+            break;
+        case 6u:
+            key = (((4 * len) | 5) + len);
+            break;
+        case 7u:
+            key = (((len >> 4) | 7) + len);
+            break;
+        case 8u:
+            key = ((len ^ 0xC) + len);
+            break;
+        default:
+            key = ((len ^ 0x40) + len);
+            break;
+        }
+
+        // (key & 0x80) ^ ~c
+        return uint8_t(0xFF ^ (key & 0x80));
+    }
+
+    static void XorBytes(char *str, size_t len, uint8_t mask)
     {
-        std::string name = IGameProfile::GetNameEntryString(entry);
+        size_t i = 0;
 
-        auto dec_ansi = [](char *str, uint32_t len)
+#if defined(__aarch64__)
+        const uint8x16_t vmask = vdupq_n_u8(mask);
+        for (; i + 16 <= len; i += 16)
         {
-            if (!str || !*str || len == 0) return;
-
-            uint32_t key = 0;
-            switch (len % 9)
-            {
-            case 0u:
-                key = ((len & 0x1F) + len);
-                break;
-            case 1u:
-                key = ((len ^ 0xDF) + len);
-                break;
-            case 2u:
-                key = ((len | 0xCF) + len);
-                break;
-            case 3u:
-                key = (33 * len);
-                break;
-            case 4u:
-                key = (len + (len >> 2));
-                break;
-            case 5u:
-                key = (3 * len + 5);
-                break;
-            case 6u:
-                key = (((4 * len) | 5) + len);
-                break;
-            case 7u:
-                key = (((len >> 4) | 7) + len);
-                break;
-            case 8u:
-                key = ((len ^ 0xC) + len);
-                break;
-            default:
-                key = ((len ^ 0x40) + len);
-                break;
-            }
-
-            for (uint32_t i = 0; i < len; i++)
-            {
-                str[i] = (key & 0x80) ^ ~str[i];
-            }
-        };
+            uint8_t *p = reinterpret_cast<uint8_t *>(str + i);
+            vst1q_u8(p, veorq_u8(vld1q_u8(p), vmask));
+        }
+#elif defined(__SSE2__)
+        const __m128i vmask = _mm_set1_epi8(char(mask));
+        for (; i + 16 <= len; i += 16)
+        {
+            __m128i *p = reinterpret_cast<__m128i *>(str + i);
+            _mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), vmask));
+        }
+#endif
+
+        const uint64_t mask64 = uint64_t(mask) * 0x0101010101010101ull;
+        for (; i + 8 <= len; i += 8)
+        {
+            uint64_t v = 0;
+            memcpy(&v, str + i, sizeof(v));
+            v ^= mask64;
+            memcpy(str + i, &v, sizeof(v));
+        }
 
-        dec_ansi(name.data(), uint32_t(name.length()));
+        for (; i < len; i++)
+            str[i] = char(uint8_t(str[i]) ^ mask);
+    }
 
-        return name;
+    void DecryptNames(std::string *names, size_t count) const override
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            std::string &name = names[i];
+            if (name.empty() || name[0] == '\0')
+                continue;
+
+            XorBytes(name.data(), name.size(), GetNameXorMask(uint32_t(name.size())));
+        }
     }
 };
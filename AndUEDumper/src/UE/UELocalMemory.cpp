@@ -0,0 +1,121 @@
+#include "UELocalMemory.hpp"
+
+#ifndef kEXECUTABLE
+
+#include <csetjmp>
+#include <cstring>
+
+#include "../Utils/Logger.hpp"
+
+namespace
+{
+    thread_local sigjmp_buf tProbeJmp;
+    thread_local volatile sig_atomic_t tProbeActive = 0;
+
+    struct sigaction *pOldSegv = nullptr;
+    struct sigaction *pOldBus = nullptr;
+
+    void chainSignal(int sig, siginfo_t *info, void *context)
+    {
+        struct sigaction *old = (sig == SIGBUS) ? pOldBus : pOldSegv;
+        if (old && (old->sa_flags & SA_SIGINFO) && old->sa_sigaction)
+        {
+            old->sa_sigaction(sig, info, context);
+            return;
+        }
+
+        if (old && old->sa_handler == SIG_IGN)
+            return;
+
+        if (old && old->sa_handler != SIG_DFL)
+        {
+            old->sa_handler(sig);
+            return;
+        }
+
+        // default action, restore and let the fault happen again on return
+        signal(sig, SIG_DFL);
+    }
+
+    void probeHandler(int sig, siginfo_t *info, void *context)
+    {
+        if (tProbeActive)
+        {
+            tProbeActive = 0;
+            siglongjmp(tProbeJmp, 1);
+        }
+
+        chainSignal(sig, info, context);
+    }
+}  // namespace
+
+bool UELocalMemoryBackend::Install()
+{
+    if (_installed)
+        return true;
+
+    struct sigaction sa{};
+    sa.sa_sigaction = probeHandler;
+    // SA_NODEFER keeps the signal unblocked after siglongjmp, so sigsetjmp doesn't need to save the mask
+    sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_NODEFER;
+    sigemptyset(&sa.sa_mask);
+
+    if (sigaction(SIGSEGV, &sa, &_oldSegv) != 0)
+    {
+        LOGE("UELocalMemoryBackend: Failed to install SIGSEGV handler.");
+        return false;
+    }
+
+    if (sigaction(SIGBUS, &sa, &_oldBus) != 0)
+    {
+        LOGE("UELocalMemoryBackend: Failed to install SIGBUS handler.");
+        sigaction(SIGSEGV, &_oldSegv, nullptr);
+        return false;
+    }
+
+    pOldSegv = &_oldSegv;
+    pOldBus = &_oldBus;
+    _installed = true;
+    return true;
+}
+
+void UELocalMemoryBackend::Uninstall()
+{
+    if (!_installed)
+        return;
+
+    sigaction(SIGSEGV, &_oldSegv, nullptr);
+    sigaction(SIGBUS, &_oldBus, nullptr);
+
+    pOldSegv = nullptr;
+    pOldBus = nullptr;
+    _installed = false;
+}
+
+size_t UELocalMemoryBackend::Read(uintptr_t address, void *buffer, size_t len) const
+{
+    if (!_installed || !address || !buffer || len == 0)
+        return 0;
+
+    if (sigsetjmp(tProbeJmp, 0) != 0)
+        return 0;
+
+    tProbeActive = 1;
+    memcpy(buffer, (const void *)address, len);
+    tProbeActive = 0;
+
+    return len;
+}
+
+bool UELocalMemoryBackend::IsReadable(uintptr_t address, size_t len) const
+{
+    if (!_installed)
+        return false;
+
+    if (UEMemory::Regions::IsBuilt())
+        return UEMemory::Regions::IsReadable(address, len);
+
+    return UEMemory::PtrValidator.isPtrReadable(address, len);
+}
+
+#endif  // kEXECUTABLE
@@ -0,0 +1,37 @@
+#pragma once
+
+// In-process backend, only available for the library build
+#ifndef kEXECUTABLE
+
+#include <csignal>
+#include <cstdint>
+
+#include "UEMemory.hpp"
+
+// Reads own process memory by direct dereference instead of process_vm_readv.
+// Addresses are checked against the readable regions index first,
+// a fault that still happens (unmapped after cache refresh, guard pages) is caught by a SIGSEGV / SIGBUS probe.
+class UELocalMemoryBackend : public UEMemory::IMemoryBackend
+{
+    struct sigaction _oldSegv;
+    struct sigaction _oldBus;
+    bool _installed;
+
+public:
+    UELocalMemoryBackend() : _oldSegv{}, _oldBus{}, _installed(false) {}
+    ~UELocalMemoryBackend() { Uninstall(); }
+
+    UELocalMemoryBackend(const UELocalMemoryBackend &) = delete;
+    UELocalMemoryBackend &operator=(const UELocalMemoryBackend &) = delete;
+
+    // installs fault handlers, previous handlers are chained for faults outside of reads
+    bool Install();
+    void Uninstall();
+
+    bool IsInstalled() const { return _installed; }
+
+    size_t Read(uintptr_t address, void *buffer, size_t len) const override;
+    bool IsReadable(uintptr_t address, size_t len) const override;
+};
+
+#endif  // kEXECUTABLE
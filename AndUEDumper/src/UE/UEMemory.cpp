@@ -1,66 +1,818 @@
 #include "UEMemory.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cwchar>
+#include <type_traits>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#include <fmt/format.h>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
 namespace UEMemory
 {
     KittyMemoryMgr kMgr{};
     KittyPtrValidator PtrValidator;
 
+    static std::unique_ptr<UEPageCache> pPageCache = nullptr;
+    static std::unique_ptr<UEPageMirror> pPageMirror = nullptr;
+    static std::unique_ptr<UEReadExecutor> pReadExecutor = nullptr;
+    static std::unique_ptr<UEReadTrace::Writer> pTraceWriter = nullptr;
+    // trace writer set aside by Trace::Pause
+    static std::unique_ptr<UEReadTrace::Writer> pPausedTraceWriter = nullptr;
+
+    // set by MemOps calibration, nullptr = kMgr
+    static const KittyMemoryMgr *pSmallReadsMgr = nullptr;
+    static const KittyMemoryMgr *pBulkReadsMgr = nullptr;
+    static const IMemoryBackend *pBackend = nullptr;
+
+    static struct
+    {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> failed{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> targetReads{0};
+    } readCounters;
+
+    static inline void countRead(std::atomic<uint64_t> &counter, uint64_t n = 1)
+    {
+        counter.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    ReadStats GetReadStats()
+    {
+        ReadStats stats;
+        stats.calls = readCounters.calls.load(std::memory_order_relaxed);
+        stats.bytes = readCounters.bytes.load(std::memory_order_relaxed);
+        stats.failed = readCounters.failed.load(std::memory_order_relaxed);
+        stats.rejected = readCounters.rejected.load(std::memory_order_relaxed);
+        stats.targetReads = readCounters.targetReads.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void ResetReadStats()
+    {
+        readCounters.calls = 0;
+        readCounters.bytes = 0;
+        readCounters.failed = 0;
+        readCounters.rejected = 0;
+        readCounters.targetReads = 0;
+    }
+
+    static size_t readMem(uintptr_t address, void *buffer, size_t len)
+    {
+        countRead(readCounters.targetReads);
+
+        if (pBackend)
+            return pBackend->Read(address, buffer, len);
+
+        const KittyMemoryMgr *mgr = (len <= MemOps::kSmallReadMaxSize) ? pSmallReadsMgr : pBulkReadsMgr;
+        return (mgr ? mgr : &kMgr)->readMem(address, buffer, len);
+    }
+
+    // served by the page mirror or cache when enabled and len is small enough
+    static bool readCached(uintptr_t address, void *buffer, size_t len)
+    {
+        if (len <= PageCache::kMaxCachedReadSize)
+        {
+            if (pPageMirror)
+                return pPageMirror->Read(address, buffer, len);
+
+            if (pPageCache)
+                return pPageCache->Read(address, buffer, len);
+        }
+        return readMem(address, buffer, len) == len;
+    }
+
+    void SetBackend(const IMemoryBackend *backend)
+    {
+        pBackend = backend;
+        PageCache::Invalidate();
+    }
+
+    const IMemoryBackend *GetBackend()
+    {
+        return pBackend;
+    }
+
+    bool IsPtrReadable(const void *address, size_t len)
+    {
+        if (pBackend)
+            return pBackend->IsReadable(uintptr_t(address), len);
+
+        if (Regions::IsBuilt())
+            return Regions::IsReadable(uintptr_t(address), len);
+
+        return PtrValidator.isPtrReadable(address, len);
+    }
+
     bool vm_rpm_ptr(const void *address, void *result, size_t len)
     {
-        if (!PtrValidator.isPtrReadable(address))
-            return false;
+        countRead(readCounters.calls);
+        countRead(readCounters.bytes, len);
+
+        bool ok = false;
+        if (Prefetch::IsActive() && Prefetch::Read(address, result, len))
+        {
+            ok = true;
+        }
+        else if (!IsPtrReadable(address))
+        {
+            countRead(readCounters.rejected);
+        }
+        else
+        {
+            ok = readCached(uintptr_t(address), result, len);
+
+            if (!ok)
+                countRead(readCounters.failed);
+        }
 
-        return kMgr.readMem(uintptr_t(address), result, len) == len;
+        if (pTraceWriter)
+            pTraceWriter->RecordRead(uintptr_t(address), len, result, ok);
+
+        return ok;
     }
 
-    std::string vm_rpm_str(const void *address, size_t max_len)
+    static std::atomic<bool> bBatchSyscallUnavailable{false};
+
+    // reads requests one by one, returns count of successful reads
+    static size_t vm_rpm_batch_single(ReadRequest *requests, size_t count)
     {
-        std::vector<char> chars(max_len, '\0');
-        if (!vm_rpm_ptr(address, chars.data(), max_len))
-            return "";
+        size_t n = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!requests[i].success) continue;
+
+            requests[i].success = readMem(uintptr_t(requests[i].address), requests[i].buffer, requests[i].len) == requests[i].len;
+            if (requests[i].success) n++;
+        }
+        return n;
+    }
 
-        std::string str = "";
-        for (size_t i = 0; i < chars.size(); i++)
+    // reads requests that passed validation, returns count of successful reads
+    static size_t vm_rpm_batch_valid(ReadRequest *requests, size_t count, bool cached)
+    {
+        if (cached && (pPageCache || pPageMirror))
         {
-            if (chars[i] == '\0')
-                break;
+            size_t n = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                auto &req = requests[i];
+                if (!req.success) continue;
 
-            str.push_back(chars[i]);
+                req.success = readCached(uintptr_t(req.address), req.buffer, req.len);
+                if (req.success) n++;
+            }
+            return n;
         }
 
-        chars.clear();
-        chars.shrink_to_fit();
+        if (pBackend || bBatchSyscallUnavailable)
+            return vm_rpm_batch_single(requests, count);
 
-        if ((int)str[0] == 0 && str.size() == 1)
-            return "";
+        const pid_t pid = kMgr.processID();
 
-        return str;
+        std::vector<struct iovec> local_iov, remote_iov;
+        std::vector<size_t> iov_requests;
+        local_iov.reserve(std::min<size_t>(count, IOV_MAX));
+        remote_iov.reserve(std::min<size_t>(count, IOV_MAX));
+        iov_requests.reserve(std::min<size_t>(count, IOV_MAX));
+
+        size_t n = 0, i = 0;
+        while (i < count)
+        {
+            local_iov.clear();
+            remote_iov.clear();
+            iov_requests.clear();
+
+            for (; i < count && iov_requests.size() < IOV_MAX; i++)
+            {
+                auto &req = requests[i];
+                if (!req.success) continue;
+
+                local_iov.push_back({req.buffer, req.len});
+                remote_iov.push_back({const_cast<void *>(req.address), req.len});
+                iov_requests.push_back(i);
+            }
+
+            size_t iov_start = 0;
+            while (iov_start < iov_requests.size())
+            {
+                const size_t iov_count = iov_requests.size() - iov_start;
+                errno = 0;
+                countRead(readCounters.targetReads);
+                ssize_t nread = syscall(__NR_process_vm_readv, pid, local_iov.data() + iov_start, iov_count, remote_iov.data() + iov_start, iov_count, 0);
+                if (nread < 0)
+                {
+                    int err = errno;
+                    if (err == ENOSYS || err == EPERM)
+                    {
+                        bBatchSyscallUnavailable = true;
+                        for (size_t j = iov_start; j < iov_requests.size(); j++)
+                        {
+                            auto &req = requests[iov_requests[j]];
+                            req.success = readMem(uintptr_t(req.address), req.buffer, req.len) == req.len;
+                            if (req.success) n++;
+                        }
+                        break;
+                    }
+
+                    // first entry failed before any transfer, skip it
+                    requests[iov_requests[iov_start]].success = false;
+                    iov_start++;
+                    continue;
+                }
+
+                // transfer stops at the first entry that couldn't be read entirely
+                size_t transferred = size_t(nread);
+                while (iov_start < iov_requests.size() && transferred >= remote_iov[iov_start].iov_len)
+                {
+                    transferred -= remote_iov[iov_start].iov_len;
+                    iov_start++;
+                    n++;
+                }
+
+                if (iov_start < iov_requests.size())
+                {
+                    requests[iov_requests[iov_start]].success = false;
+                    iov_start++;
+                }
+            }
+        }
+
+        return n;
     }
 
-    std::wstring vm_rpm_strw(const void *address, size_t max_len)
+    static size_t vm_rpm_batch_impl(ReadRequest *requests, size_t count, bool cached)
     {
-        std::vector<wchar_t> chars(max_len, '\0');
-        if (!vm_rpm_ptr(address, chars.data(), max_len * 2))
-            return L"";
+        if (!requests || count == 0)
+            return 0;
 
-        std::wstring str = L"";
-        for (size_t i = 0; i < chars.size(); i++)
+        size_t validCount = 0;
+        for (size_t i = 0; i < count; i++)
         {
-            if (chars[i] == L'\0')
-                break;
+            auto &req = requests[i];
+            countRead(readCounters.bytes, req.len);
+            req.success = req.buffer && req.len > 0 && IsPtrReadable(req.address);
+            if (req.success)
+                validCount++;
+        }
 
-            str.push_back(chars[i]);
+        countRead(readCounters.calls, count);
+        countRead(readCounters.rejected, count - validCount);
+
+        size_t n = vm_rpm_batch_valid(requests, count, cached);
+        countRead(readCounters.failed, validCount - n);
+
+        if (pTraceWriter)
+        {
+            for (size_t i = 0; i < count; i++)
+                pTraceWriter->RecordRead(uintptr_t(requests[i].address), requests[i].len, requests[i].buffer, requests[i].success);
         }
 
-        chars.clear();
-        chars.shrink_to_fit();
+        return n;
+    }
+
+    size_t vm_rpm_batch(ReadRequest *requests, size_t count)
+    {
+        return vm_rpm_batch_impl(requests, count, true);
+    }
+
+    size_t vm_rpm_batch_uncached(ReadRequest *requests, size_t count)
+    {
+        return vm_rpm_batch_impl(requests, count, false);
+    }
+
+    template <typename CharT>
+    static std::basic_string<CharT> vm_rpm_str_impl(const void *address, size_t max_len)
+    {
+        std::basic_string<CharT> str;
+        if (!address || max_len == 0)
+            return str;
+
+        constexpr size_t kChunkLen = 0x100;
+        CharT buffer[kChunkLen];
+
+        uintptr_t current = uintptr_t(address);
+        size_t remaining = max_len;
+
+        while (remaining > 0)
+        {
+            const size_t pageLeft = (UEPageCache::kPageSize - (current & (UEPageCache::kPageSize - 1))) / sizeof(CharT);
+            const size_t chunkLen = std::min({remaining, std::max<size_t>(pageLeft, 1), kChunkLen});
+            if (!vm_rpm_ptr((const void *)current, buffer, chunkLen * sizeof(CharT)))
+                break;
+
+            const CharT *nul = nullptr;
+            if constexpr (std::is_same_v<CharT, char>)
+                nul = static_cast<const CharT *>(memchr(buffer, 0, chunkLen));
+            else if constexpr (std::is_same_v<CharT, wchar_t>)
+                nul = wmemchr(buffer, 0, chunkLen);
+            else
+                nul = std::char_traits<CharT>::find(buffer, chunkLen, CharT(0));
+
+            if (nul)
+            {
+                str.append(buffer, size_t(nul - buffer));
+                break;
+            }
 
-        if ((int)str[0] == 0 && str.size() == 1)
-            return L"";
+            str.append(buffer, chunkLen);
+            current += chunkLen * sizeof(CharT);
+            remaining -= chunkLen;
+        }
 
         return str;
     }
 
+    std::string vm_rpm_str(const void *address, size_t max_len)
+    {
+        return vm_rpm_str_impl<char>(address, max_len);
+    }
+
+    std::wstring vm_rpm_strw(const void *address, size_t max_len)
+    {
+        return vm_rpm_str_impl<wchar_t>(address, max_len);
+    }
+
+    std::u16string vm_rpm_str16(const void *address, size_t max_len)
+    {
+        return vm_rpm_str_impl<char16_t>(address, max_len);
+    }
+
+    namespace PageCache
+    {
+        void Enable(size_t maxPages)
+        {
+            pPageCache = std::make_unique<UEPageCache>(readMem, maxPages);
+        }
+
+        void Disable()
+        {
+            pPageCache.reset();
+        }
+
+        bool IsEnabled()
+        {
+            return pPageCache != nullptr;
+        }
+
+        void Invalidate()
+        {
+            if (pPageCache)
+                pPageCache->Invalidate();
+        }
+
+        void Invalidate(const void *address, size_t len)
+        {
+            if (pPageCache)
+                pPageCache->Invalidate(uintptr_t(address), len);
+        }
+
+        UEPageCache::Stats GetStats()
+        {
+            return pPageCache ? pPageCache->GetStats() : UEPageCache::Stats{};
+        }
+
+        void ResetStats()
+        {
+            if (pPageCache)
+                pPageCache->ResetStats();
+        }
+    }  // namespace PageCache
+
+    namespace Mirror
+    {
+        void Enable()
+        {
+            pPageMirror = std::make_unique<UEPageMirror>(readMem);
+        }
+
+        void Disable()
+        {
+            pPageMirror.reset();
+        }
+
+        bool IsEnabled()
+        {
+            return pPageMirror != nullptr;
+        }
+
+        bool Load(const std::string &path)
+        {
+            if (!pPageMirror || access(path.c_str(), F_OK) != 0)
+                return pPageMirror != nullptr;
+
+            return pPageMirror->Load(path);
+        }
+
+        bool Save(const std::string &path)
+        {
+            return pPageMirror && pPageMirror->Save(path);
+        }
+
+        void Refresh()
+        {
+            if (pPageMirror)
+                pPageMirror->Refresh(MemOps::kBulkReadSize, ReadExecutor::Run);
+        }
+
+        void Invalidate(const void *address, size_t len)
+        {
+            if (pPageMirror)
+                pPageMirror->Invalidate(uintptr_t(address), len);
+        }
+
+        bool IsChanged(const void *address, size_t len)
+        {
+            return !pPageMirror || pPageMirror->IsChanged(uintptr_t(address), len);
+        }
+
+        UEPageMirror::Stats GetStats()
+        {
+            return pPageMirror ? pPageMirror->GetStats() : UEPageMirror::Stats{};
+        }
+
+        void ResetStats()
+        {
+            if (pPageMirror)
+                pPageMirror->ResetStats();
+        }
+    }  // namespace Mirror
+
+    namespace ReadExecutor
+    {
+        void SetThreadCount(size_t threads)
+        {
+            pReadExecutor.reset();
+            if (threads > 1)
+                pReadExecutor = std::make_unique<UEReadExecutor>(threads);
+        }
+
+        size_t GetThreadCount()
+        {
+            return pReadExecutor ? pReadExecutor->GetThreadCount() : 1;
+        }
+
+        void Run(size_t count, const UEReadExecutor::Job &job)
+        {
+            if (pReadExecutor)
+            {
+                pReadExecutor->Run(count, job);
+                return;
+            }
+
+            for (size_t i = 0; i < count; i++)
+                job(i);
+        }
+    }  // namespace ReadExecutor
+
+    namespace Trace
+    {
+        bool Start(const std::string &path)
+        {
+            auto writer = std::make_unique<UEReadTrace::Writer>();
+            if (!writer->Open(path))
+                return false;
+
+            pTraceWriter = std::move(writer);
+            return true;
+        }
+
+        void Stop()
+        {
+            pTraceWriter.reset();
+            pPausedTraceWriter.reset();
+        }
+
+        void Pause()
+        {
+            if (pTraceWriter)
+                pPausedTraceWriter = std::move(pTraceWriter);
+        }
+
+        void Resume()
+        {
+            if (pPausedTraceWriter)
+                pTraceWriter = std::move(pPausedTraceWriter);
+        }
+
+        bool IsActive()
+        {
+            return pTraceWriter != nullptr;
+        }
+
+        void SetPhase(const std::string &name)
+        {
+            if (pTraceWriter)
+                pTraceWriter->SetPhase(name);
+        }
+    }  // namespace Trace
+
+    namespace MemOps
+    {
+        static KittyMemoryMgr kSyscallMgr;
+        static KittyMemoryMgr kIOMgr;
+        static Calibration calibration;
+
+        constexpr size_t kCalibrationSmallReads = 4096;
+        constexpr size_t kCalibrationBulkReads = 64;
+
+        static const char *opToStr(EKittyMemOP op)
+        {
+            switch (op)
+            {
+            case EK_MEM_OP_SYSCALL:
+                return "SYSCALL";
+            case EK_MEM_OP_IO:
+                return "IO";
+            default:
+                return "NONE";
+            }
+        }
+
+        // returns ns per read, 0 if any read failed
+        static double timeReads(const KittyMemoryMgr &mgr, uintptr_t start, size_t len, size_t readSize, size_t stride, size_t reads)
+        {
+            std::vector<uint8_t> buffer(readSize);
+            const size_t positions = (len - readSize) / stride + 1;
+
+            auto begin = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < reads; i++)
+            {
+                const uintptr_t address = start + (i % positions) * stride;
+                if (mgr.readMem(address, buffer.data(), readSize) != readSize)
+                    return 0;
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            return std::chrono::duration<double, std::nano>(end - begin).count() / double(reads);
+        }
+
+        static EKittyMemOP pickFaster(double syscallNS, double ioNS)
+        {
+            if (syscallNS <= 0 && ioNS <= 0) return EK_MEM_OP_NONE;
+            if (ioNS <= 0) return EK_MEM_OP_SYSCALL;
+            if (syscallNS <= 0) return EK_MEM_OP_IO;
+            return syscallNS <= ioNS ? EK_MEM_OP_SYSCALL : EK_MEM_OP_IO;
+        }
+
+        std::string Calibration::ToString() const
+        {
+            if (!valid)
+                return "Memory Ops: not calibrated";
+
+            return fmt::format("Memory Ops:\nSmall Reads: {} (SYSCALL {:.0f} ns | IO {:.0f} ns)\nBulk Reads: {} (SYSCALL {:.0f} ns | IO {:.0f} ns, 0x{:X} bytes)",
+                               opToStr(smallReadsOp), syscallSmallNS, ioSmallNS,
+                               opToStr(bulkReadsOp), syscallBulkNS, ioBulkNS, bulkReadSize);
+        }
+
+        Calibration Calibrate(pid_t pid, const std::vector<KittyMemoryEx::ProcMap> &maps)
+        {
+            Reset();
+
+            const KittyMemoryEx::ProcMap *target = nullptr;
+            for (const auto &it : maps)
+            {
+                if (it.readable && it.length >= sizeof(void *) && (!target || it.length > target->length))
+                    target = &it;
+            }
+
+            if (!target)
+                return calibration;
+
+            const bool hasSyscall = kSyscallMgr.initialize(pid, EK_MEM_OP_SYSCALL, false);
+            const bool hasIO = kIOMgr.initialize(pid, EK_MEM_OP_IO, false);
+
+            Calibration result{};
+            result.bulkReadSize = std::min<size_t>(kBulkReadSize, target->length);
+
+            const uintptr_t start = target->startAddress;
+            const size_t len = target->length;
+
+            // one untimed pass each so both ops start warm
+            if (hasSyscall) timeReads(kSyscallMgr, start, len, sizeof(void *), 0x40, 64);
+            if (hasIO) timeReads(kIOMgr, start, len, sizeof(void *), 0x40, 64);
+
+            if (hasSyscall)
+            {
+                result.syscallSmallNS = timeReads(kSyscallMgr, start, len, sizeof(void *), 0x40, kCalibrationSmallReads);
+                result.syscallBulkNS = timeReads(kSyscallMgr, start, len, result.bulkReadSize, result.bulkReadSize, kCalibrationBulkReads);
+            }
+
+            if (hasIO)
+            {
+                result.ioSmallNS = timeReads(kIOMgr, start, len, sizeof(void *), 0x40, kCalibrationSmallReads);
+                result.ioBulkNS = timeReads(kIOMgr, start, len, result.bulkReadSize, result.bulkReadSize, kCalibrationBulkReads);
+            }
+
+            result.smallReadsOp = pickFaster(result.syscallSmallNS, result.ioSmallNS);
+            result.bulkReadsOp = pickFaster(result.syscallBulkNS, result.ioBulkNS);
+            result.valid = result.smallReadsOp != EK_MEM_OP_NONE && result.bulkReadsOp != EK_MEM_OP_NONE;
+            if (!result.valid)
+                return calibration;
+
+            pSmallReadsMgr = (result.smallReadsOp == EK_MEM_OP_SYSCALL) ? &kSyscallMgr : &kIOMgr;
+            pBulkReadsMgr = (result.bulkReadsOp == EK_MEM_OP_SYSCALL) ? &kSyscallMgr : &kIOMgr;
+
+            // single syscall batches are only worth it when syscall reads can be used at all
+            if (result.syscallSmallNS <= 0)
+                bBatchSyscallUnavailable = true;
+
+            calibration = result;
+            return calibration;
+        }
+
+        const Calibration &GetCalibration()
+        {
+            return calibration;
+        }
+
+        void Reset()
+        {
+            pSmallReadsMgr = nullptr;
+            pBulkReadsMgr = nullptr;
+            calibration = Calibration{};
+        }
+    }  // namespace MemOps
+
+    namespace Prefetch
+    {
+        struct Window
+        {
+            uintptr_t start;
+            std::vector<uint8_t> data;
+        };
+
+        // sorted by start
+        static thread_local std::vector<Window> tWindows;
+        static thread_local size_t tLastHit = 0;
+        static thread_local int tScopeDepth = 0;
+
+        static const Window *findWindow(uintptr_t address, size_t len)
+        {
+            const uintptr_t end = address + len;
+
+            if (tLastHit < tWindows.size())
+            {
+                const Window &w = tWindows[tLastHit];
+                if (address >= w.start && end <= w.start + w.data.size())
+                    return &w;
+            }
+
+            auto it = std::upper_bound(tWindows.begin(), tWindows.end(), address, [](uintptr_t addr, const Window &w)
+            {
+                return addr < w.start;
+            });
+            if (it == tWindows.begin())
+                return nullptr;
+
+            --it;
+            if (end > it->start + it->data.size())
+                return nullptr;
+
+            tLastHit = size_t(it - tWindows.begin());
+            return &(*it);
+        }
+
+        const uint8_t *Add(const void *address, size_t len)
+        {
+            if (tScopeDepth <= 0 || !address || len == 0)
+                return nullptr;
+
+            if (const Window *w = findWindow(uintptr_t(address), len))
+                return w->data.data() + (uintptr_t(address) - w->start);
+
+            Window window{uintptr_t(address), std::vector<uint8_t>(len)};
+            if (!vm_rpm_ptr(address, window.data.data(), len))
+                return nullptr;
+
+            auto it = std::upper_bound(tWindows.begin(), tWindows.end(), window.start, [](uintptr_t addr, const Window &w)
+            {
+                return addr < w.start;
+            });
+            it = tWindows.insert(it, std::move(window));
+            tLastHit = size_t(it - tWindows.begin());
+
+            // moving windows around keeps their data buffers in place
+            return it->data.data();
+        }
+
+        bool Read(const void *address, void *buffer, size_t len)
+        {
+            const Window *w = findWindow(uintptr_t(address), len);
+            if (!w)
+                return false;
+
+            memcpy(buffer, w->data.data() + (uintptr_t(address) - w->start), len);
+            return true;
+        }
+
+        bool IsActive()
+        {
+            return tScopeDepth > 0 && !tWindows.empty();
+        }
+
+        Scope::Scope()
+        {
+            tScopeDepth++;
+        }
+
+        Scope::~Scope()
+        {
+            if (--tScopeDepth == 0)
+            {
+                tWindows.clear();
+                tLastHit = 0;
+            }
+        }
+    }  // namespace Prefetch
+
+    namespace Regions
+    {
+        // merged readable ranges, starts are sorted
+        static std::vector<uintptr_t> regionStarts;
+        static std::vector<uintptr_t> regionEnds;
+        static thread_local size_t tLastHit = 0;
+
+        bool Refresh(pid_t pid)
+        {
+            Clear();
+
+            for (const auto &it : KittyMemoryEx::getAllMaps(pid))
+            {
+                if (!it.readable || it.endAddress <= it.startAddress)
+                    continue;
+
+                if (!regionEnds.empty() && regionEnds.back() == it.startAddress)
+                {
+                    regionEnds.back() = it.endAddress;
+                    continue;
+                }
+
+                regionStarts.push_back(it.startAddress);
+                regionEnds.push_back(it.endAddress);
+            }
+
+            return !regionStarts.empty();
+        }
+
+        void Clear()
+        {
+            regionStarts.clear();
+            regionEnds.clear();
+        }
+
+        bool IsBuilt()
+        {
+            return !regionStarts.empty();
+        }
+
+        size_t Count()
+        {
+            return regionStarts.size();
+        }
+
+        std::vector<std::pair<uintptr_t, uintptr_t>> GetRanges()
+        {
+            std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+            ranges.reserve(regionStarts.size());
+            for (size_t i = 0; i < regionStarts.size(); i++)
+                ranges.emplace_back(regionStarts[i], regionEnds[i]);
+            return ranges;
+        }
+
+        bool IsReadable(uintptr_t address, size_t len)
+        {
+            const uintptr_t end = address + len;
+            if (address == 0 || end < address)
+                return false;
+
+            // reads are mostly clustered in the same region
+            size_t i = tLastHit;
+            if (i < regionStarts.size() && address >= regionStarts[i] && end <= regionEnds[i])
+                return true;
+
+            auto it = std::upper_bound(regionStarts.begin(), regionStarts.end(), address);
+            if (it == regionStarts.begin())
+                return false;
+
+            i = size_t(it - regionStarts.begin()) - 1;
+            if (end > regionEnds[i])
+                return false;
+
+            tLastHit = i;
+            return true;
+        }
+    }  // namespace Regions
+
     uintptr_t FindAlignedPointerRefrence(uintptr_t start, size_t range, uintptr_t ptr)
     {
         if (start == 0 || start != GetPtrAlignedOf(start))
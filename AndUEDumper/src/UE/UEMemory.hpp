@@ -4,10 +4,16 @@
 #include <cstdint>
 #include <string>
 #include <unistd.h>
+#include <vector>
 
 #include <KittyMemoryMgr.hpp>
 #include <KittyPtrValidator.hpp>
 
+#include "UEPageCache.hpp"
+#include "UEPageMirror.hpp"
+#include "UEReadExecutor.hpp"
+#include "UEReadTrace.hpp"
+
 #define kINSN_PAGE_OFFSET(x) ((uintptr_t)x & ~(uintptr_t)(4096 - 1));
 
 namespace UEMemory
@@ -15,6 +21,51 @@ namespace UEMemory
     extern KittyMemoryMgr kMgr;
     extern KittyPtrValidator PtrValidator;
 
+    // Alternative source for target memory, replaces kMgr and PtrValidator while set
+    class IMemoryBackend
+    {
+    public:
+        virtual ~IMemoryBackend() = default;
+
+        // returns bytes read
+        virtual size_t Read(uintptr_t address, void *buffer, size_t len) const = 0;
+        virtual bool IsReadable(uintptr_t address, size_t len) const = 0;
+    };
+
+    // nullptr restores live process reads, backend must outlive its use
+    void SetBackend(const IMemoryBackend *backend);
+    const IMemoryBackend *GetBackend();
+
+    bool IsPtrReadable(const void *address, size_t len = sizeof(void *));
+    inline bool IsPtrReadable(uintptr_t address, size_t len = sizeof(void *))
+    {
+        return IsPtrReadable((const void *)address, len);
+    }
+
+    // Read counters, updated by vm_rpm_* calls from all threads
+    struct ReadStats
+    {
+        uint64_t calls = 0;        // read requests, batch entries count each
+        uint64_t bytes = 0;        // bytes requested
+        uint64_t failed = 0;       // validated requests that couldn't be read
+        uint64_t rejected = 0;     // requests rejected by pointer validation
+        uint64_t targetReads = 0;  // reads that reached the target (or backend), including page fetches
+
+        ReadStats operator-(const ReadStats &other) const
+        {
+            ReadStats r;
+            r.calls = calls - other.calls;
+            r.bytes = bytes - other.bytes;
+            r.failed = failed - other.failed;
+            r.rejected = rejected - other.rejected;
+            r.targetReads = targetReads - other.targetReads;
+            return r;
+        }
+    };
+
+    ReadStats GetReadStats();
+    void ResetReadStats();
+
     bool vm_rpm_ptr(const void *address, void *result, size_t len);
 
     template <typename T>
@@ -25,8 +76,169 @@ namespace UEMemory
         return buffer;
     }
 
+    struct ReadRequest
+    {
+        const void *address = nullptr;
+        void *buffer = nullptr;
+        size_t len = 0;
+        bool success = false;
+    };
+
+    // Scatter-gather read, requests are packed into process_vm_readv calls of up to IOV_MAX entries.
+    // Each request reports its own success, returns count of successful requests.
+    size_t vm_rpm_batch(ReadRequest *requests, size_t count);
+    inline size_t vm_rpm_batch(std::vector<ReadRequest> &requests)
+    {
+        return vm_rpm_batch(requests.data(), requests.size());
+    }
+
+    // same as vm_rpm_batch but always reads the target, page cache and mirror are neither used nor updated
+    size_t vm_rpm_batch_uncached(ReadRequest *requests, size_t count);
+
+    // Reads until NUL or max_len characters, reads are split at page boundaries
+    // so a string close to an unreadable page is still read
     std::string vm_rpm_str(const void *address, size_t max_len = 1024);
     std::wstring vm_rpm_strw(const void *address, size_t max_len = 1024);
+    // UTF-16 string, max_len in code units
+    std::u16string vm_rpm_str16(const void *address, size_t max_len = 1024);
+
+    // Opt-in page cache that serves vm_rpm_ptr, vm_rpm_str and vm_rpm_strw
+    namespace PageCache
+    {
+        // 16384 pages = 64MB
+        constexpr size_t kDefaultMaxPages = 16384;
+        // larger reads bypass the cache and go to the target directly
+        constexpr size_t kMaxCachedReadSize = UEPageCache::kPageSize * 4;
+
+        // maxPages 0 = unlimited
+        void Enable(size_t maxPages = kDefaultMaxPages);
+        void Disable();
+        bool IsEnabled();
+
+        void Invalidate();
+        void Invalidate(const void *address, size_t len);
+
+        UEPageCache::Stats GetStats();
+        void ResetStats();
+    }  // namespace PageCache
+
+    // Opt-in UEPageMirror, serves the same reads as PageCache and takes precedence over it.
+    // Saved after a dump and loaded before the next one, Refresh() then tells which pages changed in between.
+    namespace Mirror
+    {
+        void Enable();
+        void Disable();
+        bool IsEnabled();
+
+        // missing file is not an error, mirror starts empty
+        bool Load(const std::string &path);
+        bool Save(const std::string &path);
+
+        // re-reads mirrored pages in bulk on the ReadExecutor, must not run concurrently with reads
+        void Refresh();
+
+        void Invalidate(const void *address, size_t len);
+
+        // true if range changed since the previous dump, or wasn't part of it
+        bool IsChanged(const void *address, size_t len);
+
+        UEPageMirror::Stats GetStats();
+        void ResetStats();
+    }  // namespace Mirror
+
+    // Shared worker pool for independent read jobs, disabled by default
+    namespace ReadExecutor
+    {
+        // threads <= 1 disables the workers, must not be called while jobs are running
+        void SetThreadCount(size_t threads);
+        size_t GetThreadCount();
+
+        // calls job(i) for i in [0, count) on the workers, returns after all jobs finished
+        void Run(size_t count, const UEReadExecutor::Job &job);
+    }  // namespace ReadExecutor
+
+    // Records every vm_rpm_* read to a UEReadTrace file
+    namespace Trace
+    {
+        // must not be called while reads are running
+        bool Start(const std::string &path);
+        void Stop();
+        bool IsActive();
+
+        // reads in between aren't recorded, same restriction as Start
+        void Pause();
+        void Resume();
+
+        // following reads are attributed to phase name
+        void SetPhase(const std::string &name);
+    }  // namespace Trace
+
+    // Times EK_MEM_OP_SYSCALL and EK_MEM_OP_IO against the target and routes each read size class to the faster one
+    namespace MemOps
+    {
+        // larger reads are bulk reads
+        constexpr size_t kSmallReadMaxSize = 0x100;
+        constexpr size_t kBulkReadSize = 0x10000;
+
+        struct Calibration
+        {
+            bool valid = false;
+            EKittyMemOP smallReadsOp = EK_MEM_OP_NONE;
+            EKittyMemOP bulkReadsOp = EK_MEM_OP_NONE;
+            // ns per read, 0 if op couldn't read the target
+            double syscallSmallNS = 0, ioSmallNS = 0;
+            double syscallBulkNS = 0, ioBulkNS = 0;
+            size_t bulkReadSize = 0;
+
+            std::string ToString() const;
+        };
+
+        // calibrates on the largest readable map, must not run concurrently with reads
+        // on failure reads keep going through kMgr
+        Calibration Calibrate(pid_t pid, const std::vector<KittyMemoryEx::ProcMap> &maps);
+        const Calibration &GetCalibration();
+
+        // routes all reads through kMgr again
+        void Reset();
+    }  // namespace MemOps
+
+    // Thread local copies of remote ranges, consulted by vm_rpm_ptr before reading the target.
+    // Copies live until the outermost Scope on the thread ends, keep scopes short as target memory may change.
+    namespace Prefetch
+    {
+        // reads range now and keeps a local copy while a Scope is active, returns the copy or nullptr
+        const uint8_t *Add(const void *address, size_t len);
+
+        // copies from prefetched ranges if [address, address + len) is fully contained in one of them
+        bool Read(const void *address, void *buffer, size_t len);
+
+        bool IsActive();
+
+        class Scope
+        {
+        public:
+            Scope();
+            ~Scope();
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+        };
+    }  // namespace Prefetch
+
+    // Sorted index of target readable regions, replaces PtrValidator lookups once built
+    namespace Regions
+    {
+        // rebuilds index from target maps, call after target mappings changed
+        // must not run concurrently with reads
+        bool Refresh(pid_t pid);
+        void Clear();
+        bool IsBuilt();
+
+        size_t Count();
+        std::vector<std::pair<uintptr_t, uintptr_t>> GetRanges();
+
+        bool IsReadable(uintptr_t address, size_t len);
+    }  // namespace Regions
 
     template <typename T>
     constexpr uint64_t GetMaxOfType()
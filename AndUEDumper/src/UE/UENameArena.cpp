@@ -0,0 +1,89 @@
+#include "UENameArena.hpp"
+
+#include <cstring>
+#include <mutex>
+
+std::string_view UENameArena::storeLocked(std::string_view str)
+{
+    if (str.size() > kChunkSize)
+    {
+        auto chunk = std::make_unique<char[]>(str.size());
+        char *dst = chunk.get();
+        memcpy(dst, str.data(), str.size());
+        _chunkBytes += str.size();
+
+        // keep the current chunk last so its remaining space is still used
+        _chunks.insert(_chunks.empty() ? _chunks.end() : _chunks.end() - 1, std::move(chunk));
+        return std::string_view(dst, str.size());
+    }
+
+    if (_chunkUsed + str.size() > kChunkSize)
+    {
+        _chunks.push_back(std::make_unique<char[]>(kChunkSize));
+        _chunkBytes += kChunkSize;
+        _chunkUsed = 0;
+    }
+
+    char *dst = _chunks.back().get() + _chunkUsed;
+    memcpy(dst, str.data(), str.size());
+    _chunkUsed += str.size();
+    return std::string_view(dst, str.size());
+}
+
+std::string_view UENameArena::Intern(std::string_view str)
+{
+    if (str.empty())
+        return std::string_view();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+
+        auto it = _index.find(str);
+        if (it != _index.end())
+        {
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return *it;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    // interned by another thread meanwhile
+    auto it = _index.find(str);
+    if (it != _index.end())
+    {
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        return *it;
+    }
+
+    _misses.fetch_add(1, std::memory_order_relaxed);
+
+    std::string_view stored = storeLocked(str);
+    _index.insert(stored);
+    return stored;
+}
+
+void UENameArena::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    _index.clear();
+    _chunks.clear();
+    _chunkUsed = kChunkSize;
+    _chunkBytes = 0;
+    _hits = 0;
+    _misses = 0;
+}
+
+UENameArena::Stats UENameArena::GetStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+
+    Stats stats;
+    stats.hits = _hits.load(std::memory_order_relaxed);
+    stats.misses = _misses.load(std::memory_order_relaxed);
+    stats.names = _index.size();
+    stats.chunks = _chunks.size();
+    stats.memoryBytes = _chunkBytes + _index.bucket_count() * sizeof(void *) + _index.size() * (sizeof(std::string_view) + sizeof(void *) * 2);
+    return stats;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Interned names, every distinct string is stored once in fixed size chunks and handed out as a string_view.
+// Chunks are never moved or freed until Clear(), so views stay valid for the lifetime of the dump.
+// Thread safe, lookups of already interned names share the lock.
+class UENameArena
+{
+public:
+    static constexpr size_t kChunkSize = 0x10000;
+
+    struct Stats
+    {
+        uint64_t hits = 0;  // names already interned
+        uint64_t misses = 0;
+        size_t names = 0;
+        size_t chunks = 0;
+        size_t memoryBytes = 0;  // chunks and index
+
+        double hitRate() const { return (hits + misses) ? double(hits) * 100.0 / double(hits + misses) : 0; }
+    };
+
+private:
+    std::vector<std::unique_ptr<char[]>> _chunks;
+    size_t _chunkUsed;
+    size_t _chunkBytes;
+    std::unordered_set<std::string_view> _index;
+
+    std::atomic<uint64_t> _hits, _misses;
+    mutable std::shared_mutex _mutex;
+
+    // copies str into arena storage, names longer than a chunk get their own chunk
+    std::string_view storeLocked(std::string_view str);
+
+public:
+    UENameArena() : _chunkUsed(kChunkSize), _chunkBytes(0), _hits(0), _misses(0) {}
+
+    UENameArena(const UENameArena &) = delete;
+    UENameArena &operator=(const UENameArena &) = delete;
+
+    // view of the interned copy of str
+    std::string_view Intern(std::string_view str);
+
+    // invalidates all views handed out so far
+    void Clear();
+
+    Stats GetStats() const;
+};
@@ -0,0 +1,166 @@
+#include "UENameCache.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+void UENameCache::resizeLocked(size_t capacity)
+{
+    if (capacity <= _slots.size())
+        return;
+
+    _slots.resize(capacity, 0);
+    _occupied.resize((capacity + 63) / 64, 0);
+}
+
+const uint32_t *UENameCache::findLocked(size_t index) const
+{
+    if (index < _slots.size())
+        return ((_occupied[index / 64] >> (index % 64)) & 1) ? &_slots[index] : nullptr;
+
+    if (_sparse.empty())
+        return nullptr;
+
+    auto it = _sparse.find(int32_t(index));
+    return it != _sparse.end() ? &it->second : nullptr;
+}
+
+void UENameCache::Reserve(size_t capacity)
+{
+    if (capacity == 0)
+        return;
+
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    _maxSlots = std::min(std::max(capacity, _slots.size()), kMaxSlots);
+    resizeLocked(_maxSlots);
+}
+
+bool UENameCache::Get(int32_t id, std::string *out)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+
+        const uint32_t *slot = id >= 0 ? findLocked(size_t(id)) : nullptr;
+        if (slot)
+        {
+            *out = _names[*slot];
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    _misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void UENameCache::Put(int32_t id, const std::string &name)
+{
+    if (id < 0)
+        return;
+
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    const size_t index = size_t(id);
+    if (index >= _slots.size() && index < _maxSlots)
+        resizeLocked(std::min(std::max(index + 1, _slots.size() + _slots.size() / 2), _maxSlots));
+
+    if (index < _slots.size())
+    {
+        uint64_t &bits = _occupied[index / 64];
+        const uint64_t bit = uint64_t(1) << (index % 64);
+        if (bits & bit)
+            return;
+
+        _slots[index] = uint32_t(_names.size());
+        bits |= bit;
+    }
+    else
+    {
+        // most likely a garbage id, keep a bounded number of them
+        if (_sparse.size() >= kMaxSparseNames || !_sparse.emplace(id, uint32_t(_names.size())).second)
+            return;
+    }
+
+    _names.push_back(name);
+    _stringBytes += name.size();
+
+    if (_indexed)
+        _ids.emplace(DisplayKey(_names.back()), id);
+}
+
+std::string_view UENameCache::DisplayKey(std::string_view name)
+{
+    auto pos = name.rfind('/');
+    if (pos != std::string_view::npos)
+        name.remove_prefix(pos + 1);
+
+    return name;
+}
+
+void UENameCache::BuildIndex()
+{
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    _ids.clear();
+    _ids.reserve(_names.size());
+    for (size_t word = 0; word < _occupied.size(); word++)
+    {
+        for (uint64_t bits = _occupied[word]; bits; bits &= bits - 1)
+        {
+            const size_t index = word * 64 + size_t(__builtin_ctzll(bits));
+            _ids.emplace(DisplayKey(_names[_slots[index]]), int32_t(index));
+        }
+    }
+    for (const auto &it : _sparse)
+        _ids.emplace(DisplayKey(_names[it.second]), it.first);
+    _indexed = true;
+}
+
+bool UENameCache::IsIndexed() const
+{
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    return _indexed;
+}
+
+bool UENameCache::FindIDs(std::string_view displayKey, std::vector<int32_t> *out) const
+{
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+
+    if (!_indexed)
+        return false;
+
+    auto range = _ids.equal_range(displayKey);
+    for (auto it = range.first; it != range.second; ++it)
+        out->push_back(it->second);
+
+    return true;
+}
+
+void UENameCache::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    std::fill(_occupied.begin(), _occupied.end(), 0);
+    _sparse.clear();
+    _ids.clear();
+    _indexed = false;
+    _names.clear();
+    _stringBytes = 0;
+    _hits = 0;
+    _misses = 0;
+}
+
+UENameCache::Stats UENameCache::GetStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+
+    Stats stats;
+    stats.hits = _hits.load(std::memory_order_relaxed);
+    stats.misses = _misses.load(std::memory_order_relaxed);
+    stats.names = _names.size();
+    stats.capacity = _slots.size();
+    stats.memoryBytes = _slots.capacity() * sizeof(uint32_t) + _occupied.capacity() * sizeof(uint64_t) +
+                        _names.size() * sizeof(std::string) + _stringBytes +
+                        _sparse.bucket_count() * sizeof(void *) + _sparse.size() * (sizeof(int32_t) + sizeof(uint32_t) + sizeof(void *) * 2) +
+                        _ids.bucket_count() * sizeof(void *) + _ids.size() * (sizeof(std::string_view) + sizeof(int32_t) + sizeof(void *) * 2);
+    return stats;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Names resolved by id, stored in a flat slots vector indexed by the FName ComparisonIndex.
+// An occupancy bitmap marks filled slots, each slot holds the index of its string in the names vector.
+// Slots stop growing at the names table capacity, ids past it go to a small sparse map so garbage ids can't
+// blow up the slots. Once the whole names table is cached, BuildIndex() adds a reverse index from display key to ids.
+// Thread safe, lookups share the lock.
+class UENameCache
+{
+public:
+    // 64MB of slots, matches the names capacity limit of the profile
+    static constexpr size_t kMaxSlots = size_t(1) << 24;
+    // names with ids past the slots, further ones aren't cached
+    static constexpr size_t kMaxSparseNames = 0x10000;
+
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t names = 0;
+        size_t capacity = 0;     // slots
+        size_t memoryBytes = 0;  // slots, bitmap and strings
+
+        double hitRate() const { return (hits + misses) ? double(hits) * 100.0 / double(hits + misses) : 0; }
+    };
+
+private:
+    std::vector<uint32_t> _slots;
+    std::vector<uint64_t> _occupied;
+    size_t _maxSlots;
+    // id to names index for ids past _maxSlots
+    std::unordered_map<int32_t, uint32_t> _sparse;
+    // deque keeps strings in place, the index holds views of them
+    std::deque<std::string> _names;
+    size_t _stringBytes;
+
+    std::unordered_multimap<std::string_view, int32_t> _ids;
+    bool _indexed;
+
+    std::atomic<uint64_t> _hits, _misses;
+    mutable std::shared_mutex _mutex;
+
+    void resizeLocked(size_t capacity);
+    // names index of a cached id or nullptr
+    const uint32_t *findLocked(size_t index) const;
+
+public:
+    UENameCache() : _maxSlots(kMaxSlots), _stringBytes(0), _indexed(false), _hits(0), _misses(0) {}
+
+    UENameCache(const UENameCache &) = delete;
+    UENameCache &operator=(const UENameCache &) = delete;
+
+    // grows slots to hold ids in [0, capacity) and stops them there, without it slots grow on insert up to kMaxSlots
+    void Reserve(size_t capacity);
+
+    bool Get(int32_t id, std::string *out);
+    void Put(int32_t id, const std::string &name);
+
+    // name as displayed without the path, "/Script/Engine" is keyed as "Engine"
+    static std::string_view DisplayKey(std::string_view name);
+
+    // call once every name is cached, names put afterwards are indexed as they come
+    void BuildIndex();
+    bool IsIndexed() const;
+
+    // ids of names with the given display key, false if the index isn't built
+    bool FindIDs(std::string_view displayKey, std::vector<int32_t> *out) const;
+
+    void Clear();
+
+    Stats GetStats() const;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// How name entries encode their length and wide flag, selected once with the offsets.
+// Known layouts are decoded at compile time, Custom goes through the offsets std::function members.
+enum class UENameEntryLayout : uint8_t
+{
+    Custom = 0,
+    // FNameEntry, wide flag in bit 0 of the entry index
+    GNames,
+    // UE4.23+ FNameEntryHeader, bIsWide:1 LowercaseProbeHash:5 Len:10
+    NamePool,
+    // WITH_CASE_PRESERVING_NAME FNameEntryHeader, bIsWide:1 Len:15
+    NamePoolCasePreserving,
+};
+
+namespace UENameHeaders
+{
+    struct GNamesHeader
+    {
+        static constexpr bool IsWide(int32_t index) { return (index & 1) != 0; }
+    };
+
+    // FNAME_OUTLINE_NUMBER (UE5): zero length entries hold the id of their base entry and a number
+    template <bool bCasePreserving, bool bOutlineNumber>
+    struct NamePoolHeader
+    {
+        static constexpr bool IsWide(uint16_t header) { return (header & 1) != 0; }
+        static constexpr size_t Length(uint16_t header) { return bCasePreserving ? (header >> 1) : (header >> 6); }
+        static constexpr bool HasOutlineNumbers() { return bOutlineNumber; }
+    };
+
+    struct FunctionGNamesHeader
+    {
+        const std::function<bool(int32_t)> &isWide;
+
+        bool IsWide(int32_t index) const { return isWide && isWide(index); }
+    };
+
+    struct FunctionNamePoolHeader
+    {
+        const std::function<bool(uint16_t)> &isWide;
+        const std::function<size_t(uint16_t)> &length;
+        bool outlineNumbers;
+
+        bool IsWide(uint16_t header) const { return isWide && isWide(header); }
+        size_t Length(uint16_t header) const { return length ? length(header) : 0; }
+        bool HasOutlineNumbers() const { return outlineNumbers; }
+    };
+
+    // calls func with the header decoder of entry, FNameEntry offsets
+    template <typename Entry, typename Func>
+    decltype(auto) DispatchGNames(const Entry &entry, Func &&func)
+    {
+        if (entry.Layout == UENameEntryLayout::GNames)
+            return func(GNamesHeader{});
+
+        return func(FunctionGNamesHeader{entry.GetIsWide});
+    }
+
+    // calls func with the header decoder of entry, FNamePoolEntry offsets
+    // hot loops belong inside func, they are then compiled once per layout with the decoder inlined
+    template <typename Entry, typename Func>
+    decltype(auto) DispatchNamePool(const Entry &entry, bool outlineNumbers, Func &&func)
+    {
+        switch (entry.Layout)
+        {
+        case UENameEntryLayout::NamePool:
+            return outlineNumbers ? func(NamePoolHeader<false, true>{}) : func(NamePoolHeader<false, false>{});
+        case UENameEntryLayout::NamePoolCasePreserving:
+            return outlineNumbers ? func(NamePoolHeader<true, true>{}) : func(NamePoolHeader<true, false>{});
+        default:
+            return func(FunctionNamePoolHeader{entry.GetIsWide, entry.GetLength, outlineNumbers});
+        }
+    }
+}  // namespace UENameHeaders
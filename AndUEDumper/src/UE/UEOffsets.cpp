@@ -2,7 +2,6 @@
 
 #include <ostream>
 #include <sstream>
-#include <unordered_map>
 
 #include "UEMemory.hpp"
 using namespace UEMemory;
@@ -231,6 +230,7 @@ namespace UE_DefaultOffsets
 
             offsets.FNameEntry.Index = 0;
             offsets.FNameEntry.Name = GetPtrAlignedOf(sizeof(void *) + sizeof(int32_t));
+            offsets.FNameEntry.Layout = UENameEntryLayout::GNames;
             offsets.FNameEntry.GetIsWide = [](int32_t index)
             { return (index & 1) != 0; };
 
@@ -382,6 +382,7 @@ namespace UE_DefaultOffsets
 #endif
 
             offsets.FNamePoolEntry.Header = bWITH_CASE_PRESERVING_NAME ? 4 : 0;  // Offset to name entry header
+            offsets.FNamePoolEntry.Layout = bWITH_CASE_PRESERVING_NAME ? UENameEntryLayout::NamePoolCasePreserving : UENameEntryLayout::NamePool;
             offsets.FNamePoolEntry.GetIsWide = [](uint16_t header)
             { return (header & 1) != 0; };
             // usually if stride is 2 then header >> 6 and if 4 then haeder >> 1
@@ -498,6 +499,7 @@ namespace UE_DefaultOffsets
 #endif
 
             offsets.FNamePoolEntry.Header = bWITH_CASE_PRESERVING_NAME ? 4 : 0;  // Offset to name entry header
+            offsets.FNamePoolEntry.Layout = bWITH_CASE_PRESERVING_NAME ? UENameEntryLayout::NamePoolCasePreserving : UENameEntryLayout::NamePool;
             offsets.FNamePoolEntry.GetIsWide = [](uint16_t header)
             { return (header & 1) != 0; };
             // usually if stride is 2 then header >> 6 and if 4 then haeder >> 1
@@ -573,15 +575,14 @@ namespace UE_DefaultOffsets
 
 std::string UEVars::GetNameByID(int32_t id) const
 {
-    static std::unordered_map<int32_t, std::string> namesCachedMap;
-    if (namesCachedMap.count(id) > 0)
-        return namesCachedMap[id];
+    std::string name;
+    if (NamesCache && NamesCache->Get(id, &name))
+        return name;
+
+    name = pGetNameByID ? pGetNameByID(id) : "pGetNameByID_IS_NULL";
+    if (NamesCache && !name.empty())
+        NamesCache->Put(id, name);
 
-    std::string name = pGetNameByID ? pGetNameByID(id) : "pGetNameByID_IS_NULL";
-    if (!name.empty())
-    {
-        namesCachedMap[id] = name;
-    }
     return name;
 }
 
@@ -617,6 +618,8 @@ std::string UEVars::InitStatusToStr(UEVarsInitStatus s)
         return "ERROR_INIT_OFFSETS";
     case UEVarsInitStatus::ERROR_INIT_PTR_VALIDATOR:
         return "ERROR_INIT_PTR_VALIDATOR";
+    case UEVarsInitStatus::ERROR_INIT_SNAPSHOT:
+        return "ERROR_INIT_SNAPSHOT";
     default:
         break;
     }
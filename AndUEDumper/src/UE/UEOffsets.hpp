@@ -3,8 +3,12 @@
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <memory>
 #include <utility>
 
+#include "UENameCache.hpp"
+#include "UENameHeaders.hpp"
+
 #define kMAX_UENAME_BUFFER 0xff
 
 struct UE_Offsets
@@ -30,6 +34,8 @@ struct UE_Offsets
     {
         uintptr_t Index = 0;
         uintptr_t Name = 0;
+        // GetIsWide is only used with Custom layout
+        UENameEntryLayout Layout = UENameEntryLayout::Custom;
         std::function<bool(int32_t)> GetIsWide = nullptr;
     } FNameEntry;
     struct
@@ -41,6 +47,8 @@ struct UE_Offsets
     struct
     {
         uintptr_t Header = 0;
+        // GetIsWide and GetLength are only used with Custom layout
+        UENameEntryLayout Layout = UENameEntryLayout::Custom;
         std::function<bool(uint16_t)> GetIsWide = nullptr;
         std::function<size_t(uint16_t)> GetLength = nullptr;
     } FNamePoolEntry;
@@ -186,6 +194,7 @@ enum class UEVarsInitStatus : uint8_t
     ERROR_INIT_OBJOBJECTS,
     ERROR_INIT_OFFSETS,
     ERROR_INIT_PTR_VALIDATOR,
+    ERROR_INIT_SNAPSHOT,
 };
 
 struct UEVars
@@ -195,6 +204,8 @@ struct UEVars
 protected:
     uintptr_t BaseAddress;
     uintptr_t NamesPtr;
+    // TNameEntryArray that NamesPtr points to, GNames layouts only
+    uintptr_t GNamesArrayPtr;
     uintptr_t GUObjectsArrayPtr;
     uintptr_t ObjObjectsPtr;
     uintptr_t ObjObjects_Objects;
@@ -202,18 +213,21 @@ protected:
     UE_Offsets *Offsets;
 
     std::function<std::string(int32_t)> pGetNameByID;
+    // consulted before pGetNameByID
+    std::shared_ptr<UENameCache> NamesCache;
 
 public:
-    UEVars() : BaseAddress(0), NamesPtr(0), GUObjectsArrayPtr(0), ObjObjectsPtr(0), ObjObjects_Objects(0), Offsets(nullptr), pGetNameByID(nullptr)
+    UEVars() : BaseAddress(0), NamesPtr(0), GNamesArrayPtr(0), GUObjectsArrayPtr(0), ObjObjectsPtr(0), ObjObjects_Objects(0), Offsets(nullptr), pGetNameByID(nullptr)
     {
     }
 
-    UEVars(uintptr_t base, uintptr_t names, uintptr_t objectArray, uintptr_t objObjects, uintptr_t objects, UE_Offsets *offsets, const std::function<std::string(int32_t)> &pGetNameByID) : BaseAddress(base), NamesPtr(names), GUObjectsArrayPtr(objectArray), ObjObjectsPtr(objObjects), ObjObjects_Objects(objects), Offsets(offsets), pGetNameByID(pGetNameByID)
+    UEVars(uintptr_t base, uintptr_t names, uintptr_t objectArray, uintptr_t objObjects, uintptr_t objects, UE_Offsets *offsets, const std::function<std::string(int32_t)> &pGetNameByID) : BaseAddress(base), NamesPtr(names), GNamesArrayPtr(0), GUObjectsArrayPtr(objectArray), ObjObjectsPtr(objObjects), ObjObjects_Objects(objects), Offsets(offsets), pGetNameByID(pGetNameByID)
     {
     }
 
     uintptr_t GetBaseAddress() const { return BaseAddress; };
     uintptr_t GetNamesPtr() const { return NamesPtr; };
+    uintptr_t GetGNamesArrayPtr() const { return GNamesArrayPtr; };
     uintptr_t GetGUObjectsArrayPtr() const { return GUObjectsArrayPtr; };
     uintptr_t GetObjObjectsPtr() const { return ObjObjectsPtr; };
     uintptr_t GetObjObjects_Objects() const { return ObjObjects_Objects; };
@@ -221,6 +235,9 @@ public:
     UE_Offsets *GetOffsets() const { return Offsets; };
 
     std::string GetNameByID(int32_t id) const;
+    UENameCache::Stats GetNamesCacheStats() const { return NamesCache ? NamesCache->GetStats() : UENameCache::Stats{}; }
+    // ids of names displayed as displayKey, false if the names table isn't fully cached
+    bool FindNameIDs(std::string_view displayKey, std::vector<int32_t> *out) const { return NamesCache && NamesCache->FindIDs(displayKey, out); }
 
     static std::string InitStatusToStr(UEVarsInitStatus s);
 };
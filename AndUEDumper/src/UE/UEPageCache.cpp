@@ -0,0 +1,211 @@
+#include "UEPageCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+UEPageCache::UEPageCache(FetchFunc fetch, size_t maxPages) : _fetch(fetch), _maxPages(maxPages), _head(kInvalidSlot), _tail(kInvalidSlot), _generation(0)
+{
+    _stats.maxPages = maxPages;
+}
+
+void UEPageCache::unlink(uint32_t slot)
+{
+    Page &page = _pages[slot];
+
+    if (page.prev != kInvalidSlot)
+        _pages[page.prev].next = page.next;
+    else
+        _head = page.next;
+
+    if (page.next != kInvalidSlot)
+        _pages[page.next].prev = page.prev;
+    else
+        _tail = page.prev;
+
+    page.prev = page.next = kInvalidSlot;
+}
+
+void UEPageCache::pushFront(uint32_t slot)
+{
+    Page &page = _pages[slot];
+    page.prev = kInvalidSlot;
+    page.next = _head;
+
+    if (_head != kInvalidSlot)
+        _pages[_head].prev = slot;
+
+    _head = slot;
+
+    if (_tail == kInvalidSlot)
+        _tail = slot;
+}
+
+void UEPageCache::release(uint32_t slot)
+{
+    unlink(slot);
+    _pagesMap.erase(_pages[slot].address);
+    _pages[slot].address = 0;
+    _freeSlots.push_back(slot);
+}
+
+const uint8_t *UEPageCache::findPageLocked(uintptr_t pageAddress)
+{
+    auto it = _pagesMap.find(pageAddress);
+    if (it == _pagesMap.end())
+        return nullptr;
+
+    if (_head != it->second)
+    {
+        unlink(it->second);
+        pushFront(it->second);
+    }
+    return _pages[it->second].data.get();
+}
+
+void UEPageCache::insertPageLocked(uintptr_t pageAddress, const uint8_t *data)
+{
+    uint32_t slot = kInvalidSlot;
+    if (!_freeSlots.empty())
+    {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    else if (_maxPages == 0 || _pages.size() < _maxPages)
+    {
+        slot = uint32_t(_pages.size());
+        _pages.emplace_back();
+        _pages[slot].data = std::make_unique<uint8_t[]>(kPageSize);
+    }
+    else
+    {
+        // evict least recently used
+        slot = _tail;
+        unlink(slot);
+        _pagesMap.erase(_pages[slot].address);
+        _stats.evictions++;
+    }
+
+    Page &page = _pages[slot];
+    memcpy(page.data.get(), data, kPageSize);
+    page.address = pageAddress;
+    _pagesMap[pageAddress] = slot;
+    pushFront(slot);
+}
+
+bool UEPageCache::Read(uintptr_t address, void *buffer, size_t len)
+{
+    if (!buffer || len == 0)
+        return false;
+
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+    uintptr_t current = address;
+    size_t remaining = len;
+
+    uint8_t fetched[kPageSize];
+
+    while (remaining > 0)
+    {
+        const uintptr_t pageAddress = current & kPageMask;
+        const size_t pageOffset = current - pageAddress;
+        const size_t toCopy = std::min<size_t>(remaining, kPageSize - pageOffset);
+
+        uint64_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // copied under the lock, the slot may be reused once it's released
+            if (const uint8_t *page = findPageLocked(pageAddress))
+            {
+                _stats.hits++;
+                memcpy(out, page + pageOffset, toCopy);
+
+                out += toCopy;
+                current += toCopy;
+                remaining -= toCopy;
+                continue;
+            }
+
+            _stats.misses++;
+            generation = _generation;
+        }
+
+        if (_fetch(pageAddress, fetched, kPageSize) != kPageSize)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stats.failedFetches++;
+            }
+
+            // page can't be fetched as a whole, read what's left directly
+            return _fetch(current, out, remaining) == remaining;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // another thread may have inserted it meanwhile
+            if (generation == _generation && !findPageLocked(pageAddress))
+                insertPageLocked(pageAddress, fetched);
+        }
+
+        memcpy(out, fetched + pageOffset, toCopy);
+
+        out += toCopy;
+        current += toCopy;
+        remaining -= toCopy;
+    }
+
+    return true;
+}
+
+void UEPageCache::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _generation++;
+    _pagesMap.clear();
+    _freeSlots.clear();
+    for (uint32_t i = 0; i < uint32_t(_pages.size()); i++)
+    {
+        _pages[i].address = 0;
+        _pages[i].prev = _pages[i].next = kInvalidSlot;
+        _freeSlots.push_back(i);
+    }
+    _head = _tail = kInvalidSlot;
+}
+
+void UEPageCache::Invalidate(uintptr_t address, size_t len)
+{
+    if (len == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _generation++;
+
+    const uintptr_t start = address & kPageMask;
+    const uintptr_t end = address + len;
+    for (uintptr_t pageAddress = start; pageAddress < end; pageAddress += kPageSize)
+    {
+        auto it = _pagesMap.find(pageAddress);
+        if (it != _pagesMap.end())
+            release(it->second);
+    }
+}
+
+UEPageCache::Stats UEPageCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Stats stats = _stats;
+    stats.pages = _pagesMap.size();
+    return stats;
+}
+
+void UEPageCache::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _stats = Stats{};
+    _stats.maxPages = _maxPages;
+}
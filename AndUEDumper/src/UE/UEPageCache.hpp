@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Page granular LRU cache for remote reads.
+// Whole pages are fetched from the target on first access and served locally after that.
+// Fetches run outside the lock, so concurrent misses don't wait on each other.
+class UEPageCache
+{
+public:
+    static constexpr uintptr_t kPageSize = 0x1000;
+    static constexpr uintptr_t kPageMask = ~(kPageSize - 1);
+
+    // reads len bytes at address from the target, returns bytes read
+    using FetchFunc = size_t (*)(uintptr_t address, void *buffer, size_t len);
+
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t failedFetches = 0;
+        size_t pages = 0;
+        size_t maxPages = 0;
+    };
+
+private:
+    static constexpr uint32_t kInvalidSlot = ~uint32_t(0);
+
+    struct Page
+    {
+        uintptr_t address = 0;
+        uint32_t prev = kInvalidSlot;
+        uint32_t next = kInvalidSlot;
+        std::unique_ptr<uint8_t[]> data;
+    };
+
+    FetchFunc _fetch;
+    size_t _maxPages;  // 0 = unlimited
+
+    std::vector<Page> _pages;
+    std::vector<uint32_t> _freeSlots;
+    std::unordered_map<uintptr_t, uint32_t> _pagesMap;
+    uint32_t _head, _tail;  // most / least recently used
+
+    // bumped on invalidation, pages fetched across it aren't inserted
+    uint64_t _generation;
+
+    Stats _stats;
+    mutable std::mutex _mutex;
+
+    void unlink(uint32_t slot);
+    void pushFront(uint32_t slot);
+    void release(uint32_t slot);
+
+    // cached page data or nullptr, marks the page as most recently used
+    const uint8_t *findPageLocked(uintptr_t pageAddress);
+    // copies a fetched page in, evicting the least recently used one if full
+    void insertPageLocked(uintptr_t pageAddress, const uint8_t *data);
+
+public:
+    UEPageCache(FetchFunc fetch, size_t maxPages);
+
+    UEPageCache(const UEPageCache &) = delete;
+    UEPageCache &operator=(const UEPageCache &) = delete;
+
+    bool Read(uintptr_t address, void *buffer, size_t len);
+
+    void Invalidate();
+    void Invalidate(uintptr_t address, size_t len);
+
+    Stats GetStats() const;
+    void ResetStats();
+};
@@ -0,0 +1,399 @@
+#include "UEPageMirror.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "../Utils/Logger.hpp"
+
+uint64_t UEPageMirror::HashPage(const uint8_t *data)
+{
+    // FNV-1a over 64 bit words
+    uint64_t hash = 0xCBF29CE484222325;
+    for (size_t i = 0; i < kPageSize; i += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        memcpy(&word, data + i, sizeof(word));
+        hash ^= word;
+        hash *= 0x100000001B3;
+    }
+    return hash ^ (hash >> 32);
+}
+
+void UEPageMirror::addPage(uintptr_t pageAddress, const uint8_t *data, uint64_t hash, PageState state)
+{
+    Page page{};
+    page.address = pageAddress;
+    page.hash = hash;
+    page.state = state;
+    page.data = std::make_unique<uint8_t[]>(kPageSize);
+    memcpy(page.data.get(), data, kPageSize);
+
+    _pagesMap[pageAddress] = uint32_t(_pages.size());
+    _pages.push_back(std::move(page));
+}
+
+const uint8_t *UEPageMirror::findPageLocked(uintptr_t pageAddress) const
+{
+    auto it = _pagesMap.find(pageAddress);
+    if (it == _pagesMap.end() || _pages[it->second].stale)
+        return nullptr;
+
+    return _pages[it->second].data.get();
+}
+
+void UEPageMirror::storePageLocked(uintptr_t pageAddress, const uint8_t *data)
+{
+    const uint64_t hash = HashPage(data);
+
+    auto it = _pagesMap.find(pageAddress);
+    if (it == _pagesMap.end())
+    {
+        addPage(pageAddress, data, hash, PAGE_NEW);
+        return;
+    }
+
+    Page &page = _pages[it->second];
+    page.stale = false;
+    if (page.hash != hash)
+    {
+        if (page.state == PAGE_CLEAN)
+            page.state = PAGE_CHANGED;
+
+        page.hash = hash;
+        memcpy(page.data.get(), data, kPageSize);
+    }
+}
+
+bool UEPageMirror::Load(const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    Header header{};
+    if (fread(&header, 1, sizeof(header), file) != sizeof(header) || header.magic != kMagic || header.version != kVersion || header.pointerSize != sizeof(void *))
+    {
+        LOGE("Invalid mirror file \"%s\".", path.c_str());
+        fclose(file);
+        return false;
+    }
+
+    // count comes from the file, it can't hold more pages than its size allows
+    const long dataStart = ftell(file);
+    const bool sized = dataStart >= 0 && fseek(file, 0, SEEK_END) == 0;
+    const long fileSize = sized ? ftell(file) : -1;
+    if (fileSize < dataStart || fseek(file, dataStart, SEEK_SET) != 0 ||
+        header.pagesCount > uint64_t(fileSize - dataStart) / (sizeof(PageEntry) + kPageSize))
+    {
+        LOGE("Invalid mirror file \"%s\".", path.c_str());
+        fclose(file);
+        return false;
+    }
+
+    std::vector<PageEntry> entries(size_t(header.pagesCount));
+    if (fread(entries.data(), sizeof(PageEntry), entries.size(), file) != entries.size())
+    {
+        LOGE("Invalid mirror file \"%s\".", path.c_str());
+        fclose(file);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _pages.clear();
+    _pagesMap.clear();
+    _pages.reserve(entries.size());
+
+    uint8_t data[kPageSize];
+    for (const auto &entry : entries)
+    {
+        if (fread(data, 1, kPageSize, file) != kPageSize)
+            break;
+
+        // skip corrupted pages, they will be read again
+        if (HashPage(data) != entry.hash || _pagesMap.count(uintptr_t(entry.address)))
+            continue;
+
+        addPage(uintptr_t(entry.address), data, entry.hash, PAGE_NEW);
+    }
+    fclose(file);
+
+    if (_pages.size() != entries.size())
+        LOGW("Mirror file \"%s\" is incomplete, loaded %zu of %zu pages.", path.c_str(), _pages.size(), entries.size());
+
+    return true;
+}
+
+bool UEPageMirror::Save(const std::string &path) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        int err = errno;
+        LOGE("Couldn't create mirror file \"%s\" error=%d | %s.", path.c_str(), err, strerror(err));
+        return false;
+    }
+
+    // stale pages weren't re-read after invalidation, their data may be outdated
+    std::vector<const Page *> pages;
+    pages.reserve(_pages.size());
+    for (const auto &page : _pages)
+    {
+        if (!page.stale)
+            pages.push_back(&page);
+    }
+
+    Header header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.pointerSize = sizeof(void *);
+    header.pagesCount = pages.size();
+
+    std::vector<PageEntry> entries;
+    entries.reserve(pages.size());
+    for (const auto *page : pages)
+        entries.push_back({uint64_t(page->address), page->hash});
+
+    bool ok = fwrite(&header, 1, sizeof(header), file) == sizeof(header);
+    ok = ok && fwrite(entries.data(), sizeof(PageEntry), entries.size(), file) == entries.size();
+    for (size_t i = 0; ok && i < pages.size(); i++)
+        ok = fwrite(pages[i]->data.get(), 1, kPageSize, file) == kPageSize;
+
+    fclose(file);
+
+    if (!ok)
+        LOGE("Failed to write mirror file \"%s\".", path.c_str());
+
+    return ok;
+}
+
+void UEPageMirror::Refresh(size_t maxRunSize, RunFunc run)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // runs of contiguous pages in address order
+    std::vector<uint32_t> order(_pages.size());
+    for (uint32_t i = 0; i < uint32_t(order.size()); i++)
+        order[i] = i;
+
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+    {
+        return _pages[a].address < _pages[b].address;
+    });
+
+    const size_t maxRunPages = std::max<size_t>(maxRunSize / kPageSize, 1);
+    std::vector<std::pair<size_t, size_t>> runs;  // [first, last) in order
+    for (size_t i = 0; i < order.size();)
+    {
+        size_t j = i + 1;
+        while (j < order.size() && j - i < maxRunPages && _pages[order[j]].address == _pages[order[j - 1]].address + kPageSize)
+            j++;
+
+        runs.emplace_back(i, j);
+        i = j;
+    }
+
+    std::atomic<size_t> clean{0}, changed{0}, bulkReads{0};
+    std::vector<uint8_t> dropped(_pages.size(), 0);
+
+    auto refreshRun = [&](size_t r)
+    {
+        const size_t first = runs[r].first, count = runs[r].second - runs[r].first;
+        std::vector<uint8_t> buffer(count * kPageSize);
+
+        // whole run at once, page by page if part of it became unreadable
+        bulkReads.fetch_add(1, std::memory_order_relaxed);
+        const bool runOk = _fetch(_pages[order[first]].address, buffer.data(), buffer.size()) == buffer.size();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Page &page = _pages[order[first + i]];
+            uint8_t *data = buffer.data() + i * kPageSize;
+
+            if (!runOk && _fetch(page.address, data, kPageSize) != kPageSize)
+            {
+                dropped[order[first + i]] = 1;
+                continue;
+            }
+
+            const uint64_t hash = HashPage(data);
+            page.stale = false;
+            if (hash == page.hash)
+            {
+                page.state = PAGE_CLEAN;
+                clean.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                page.state = PAGE_CHANGED;
+                page.hash = hash;
+                memcpy(page.data.get(), data, kPageSize);
+                changed.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    if (run)
+        run(runs.size(), refreshRun);
+    else
+        for (size_t r = 0; r < runs.size(); r++)
+            refreshRun(r);
+
+    // compact out dropped pages
+    size_t droppedCount = 0;
+    std::vector<Page> pages;
+    pages.reserve(_pages.size());
+    _pagesMap.clear();
+    for (size_t i = 0; i < _pages.size(); i++)
+    {
+        if (dropped[i])
+        {
+            droppedCount++;
+            continue;
+        }
+
+        _pagesMap[_pages[i].address] = uint32_t(pages.size());
+        pages.push_back(std::move(_pages[i]));
+    }
+    _pages = std::move(pages);
+
+    _stats.refreshed = _pages.size() + droppedCount;
+    _stats.clean = clean;
+    _stats.changed = changed;
+    _stats.dropped = droppedCount;
+    _stats.bulkReads = bulkReads;
+    _stats.refreshMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool UEPageMirror::Read(uintptr_t address, void *buffer, size_t len)
+{
+    if (!buffer || len == 0)
+        return false;
+
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+    uintptr_t current = address;
+    size_t remaining = len;
+
+    uint8_t fetched[kPageSize];
+
+    while (remaining > 0)
+    {
+        const uintptr_t pageAddress = current & kPageMask;
+        const size_t pageOffset = current - pageAddress;
+        const size_t toCopy = std::min<size_t>(remaining, kPageSize - pageOffset);
+
+        uint64_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // copied under the lock, a concurrent miss may update the page data
+            if (const uint8_t *page = findPageLocked(pageAddress))
+            {
+                _stats.hits++;
+                memcpy(out, page + pageOffset, toCopy);
+
+                out += toCopy;
+                current += toCopy;
+                remaining -= toCopy;
+                continue;
+            }
+
+            _stats.misses++;
+            generation = _generation;
+        }
+
+        if (_fetch(pageAddress, fetched, kPageSize) != kPageSize)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stats.failedFetches++;
+            }
+
+            // page can't be fetched as a whole, read what's left directly
+            return _fetch(current, out, remaining) == remaining;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // an invalidation meanwhile means fetched may predate it, another thread may have stored it already
+            if (generation == _generation && !findPageLocked(pageAddress))
+                storePageLocked(pageAddress, fetched);
+        }
+
+        memcpy(out, fetched + pageOffset, toCopy);
+
+        out += toCopy;
+        current += toCopy;
+        remaining -= toCopy;
+    }
+
+    return true;
+}
+
+void UEPageMirror::Invalidate(uintptr_t address, size_t len)
+{
+    if (len == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _generation++;
+
+    const uintptr_t start = address & kPageMask;
+    const uintptr_t end = address + len;
+    for (uintptr_t pageAddress = start; pageAddress < end; pageAddress += kPageSize)
+    {
+        auto it = _pagesMap.find(pageAddress);
+        if (it != _pagesMap.end())
+            _pages[it->second].stale = true;
+    }
+}
+
+bool UEPageMirror::IsChanged(uintptr_t address, size_t len) const
+{
+    if (len == 0)
+        return false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const uintptr_t start = address & kPageMask;
+    const uintptr_t end = address + len;
+    for (uintptr_t pageAddress = start; pageAddress < end; pageAddress += kPageSize)
+    {
+        auto it = _pagesMap.find(pageAddress);
+        if (it == _pagesMap.end() || _pages[it->second].state != PAGE_CLEAN)
+            return true;
+    }
+    return false;
+}
+
+UEPageMirror::Stats UEPageMirror::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Stats stats = _stats;
+    stats.pages = _pages.size();
+    stats.newPages = size_t(std::count_if(_pages.begin(), _pages.end(), [](const Page &page)
+    {
+        return page.state == PAGE_NEW;
+    }));
+    return stats;
+}
+
+void UEPageMirror::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _stats.hits = 0;
+    _stats.misses = 0;
+    _stats.failedFetches = 0;
+}
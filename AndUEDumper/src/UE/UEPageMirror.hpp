@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Local copy of every target page read, with a hash per page, kept across dumps of the same process.
+//
+// Refresh() re-reads all mirrored pages in bulk and compares their hashes, pages that didn't change
+// are served locally and report clean, so a repeated dump only needs to look again at what changed.
+//
+// File layout:
+//   Header
+//   PageEntry[pagesCount]
+//   pages data, kPageSize each in entries order
+class UEPageMirror
+{
+public:
+    static constexpr uintptr_t kPageSize = 0x1000;
+    static constexpr uintptr_t kPageMask = ~(kPageSize - 1);
+
+    static constexpr uint64_t kMagic = 0x315252494D455546;  // "FUEMIRR1"
+    static constexpr uint32_t kVersion = 1;
+
+    // reads len bytes at address from the target, returns bytes read
+    using FetchFunc = size_t (*)(uintptr_t address, void *buffer, size_t len);
+    // calls job(i) for i in [0, count), jobs may run concurrently
+    using RunFunc = void (*)(size_t count, const std::function<void(size_t)> &job);
+
+    enum PageState : uint8_t
+    {
+        PAGE_NEW = 0,      // first read since the last refresh, nothing to compare with
+        PAGE_CLEAN = 1,    // same hash as the previous dump
+        PAGE_CHANGED = 2,  // hash differs from the previous dump
+    };
+
+#pragma pack(push, 1)
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t pointerSize;
+        uint64_t pagesCount;
+    };
+
+    struct PageEntry
+    {
+        uint64_t address;
+        uint64_t hash;
+    };
+#pragma pack(pop)
+
+    struct Stats
+    {
+        // refresh
+        size_t refreshed = 0;
+        size_t clean = 0;
+        size_t changed = 0;
+        size_t dropped = 0;  // no longer readable
+        size_t bulkReads = 0;
+        double refreshMS = 0;
+
+        // reads
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t failedFetches = 0;
+
+        size_t pages = 0;
+        size_t newPages = 0;
+    };
+
+private:
+    struct Page
+    {
+        uintptr_t address = 0;
+        uint64_t hash = 0;
+        PageState state = PAGE_NEW;
+        bool stale = false;  // re-fetched on next access
+        std::unique_ptr<uint8_t[]> data;
+    };
+
+    FetchFunc _fetch;
+
+    std::vector<Page> _pages;
+    std::unordered_map<uintptr_t, uint32_t> _pagesMap;
+
+    // bumped by invalidations, a fetch started before one isn't stored
+    uint64_t _generation;
+
+    Stats _stats;
+    mutable std::mutex _mutex;
+
+    // mirrored page data or nullptr if not mirrored or stale, fetches are done by the caller outside the lock
+    const uint8_t *findPageLocked(uintptr_t pageAddress) const;
+    // adds or updates a page with fetched data and updates its state
+    void storePageLocked(uintptr_t pageAddress, const uint8_t *data);
+
+    void addPage(uintptr_t pageAddress, const uint8_t *data, uint64_t hash, PageState state);
+
+public:
+    explicit UEPageMirror(FetchFunc fetch) : _fetch(fetch), _generation(0) {}
+
+    UEPageMirror(const UEPageMirror &) = delete;
+    UEPageMirror &operator=(const UEPageMirror &) = delete;
+
+    static uint64_t HashPage(const uint8_t *data);
+
+    // mirror of a previous dump, all loaded pages are NEW until refreshed
+    bool Load(const std::string &path);
+    bool Save(const std::string &path) const;
+
+    // re-reads mirrored pages in contiguous runs of up to maxRunSize bytes and updates their states
+    // must not run concurrently with reads, run may be nullptr
+    void Refresh(size_t maxRunSize, RunFunc run);
+
+    bool Read(uintptr_t address, void *buffer, size_t len);
+
+    // pages in range are re-fetched and compared on next access
+    void Invalidate(uintptr_t address, size_t len);
+
+    // true if any page in range isn't clean or isn't mirrored
+    bool IsChanged(uintptr_t address, size_t len) const;
+
+    Stats GetStats() const;
+    void ResetStats();
+};
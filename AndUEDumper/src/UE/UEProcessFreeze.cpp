@@ -0,0 +1,159 @@
+#include "UEProcessFreeze.hpp"
+
+#ifdef kEXECUTABLE
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <string>
+#include <thread>
+
+#include "../Utils/Logger.hpp"
+
+namespace
+{
+    // pid to resume from signal handlers and atexit, 0 when nothing is frozen
+    std::atomic<pid_t> gFrozenPid{0};
+
+    const int kResumeSignals[] = {SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGABRT, SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGPIPE};
+    struct sigaction gOldActions[sizeof(kResumeSignals) / sizeof(kResumeSignals[0])];
+    bool gHandlersInstalled = false;
+
+    void resumeFrozen()
+    {
+        pid_t pid = gFrozenPid.exchange(0);
+        if (pid > 0)
+            kill(pid, SIGCONT);
+    }
+
+    void resumeSignalHandler(int sig)
+    {
+        resumeFrozen();
+
+        // restore previous disposition and let the signal do its thing
+        for (size_t i = 0; i < sizeof(kResumeSignals) / sizeof(kResumeSignals[0]); i++)
+        {
+            if (kResumeSignals[i] == sig)
+            {
+                sigaction(sig, &gOldActions[i], nullptr);
+                break;
+            }
+        }
+        raise(sig);
+    }
+
+    void installHandlers()
+    {
+        if (gHandlersInstalled)
+            return;
+
+        struct sigaction sa{};
+        sa.sa_handler = resumeSignalHandler;
+        sigemptyset(&sa.sa_mask);
+
+        for (size_t i = 0; i < sizeof(kResumeSignals) / sizeof(kResumeSignals[0]); i++)
+            sigaction(kResumeSignals[i], &sa, &gOldActions[i]);
+
+        atexit(resumeFrozen);
+        gHandlersInstalled = true;
+    }
+
+    // state of /proc/<pid>/task/<tid>/stat, 0 on failure
+    char threadState(pid_t pid, const char *tid)
+    {
+        char path[64] = {0};
+        snprintf(path, sizeof(path), "/proc/%d/task/%s/stat", pid, tid);
+
+        FILE *file = fopen(path, "r");
+        if (!file)
+            return 0;
+
+        char buf[512] = {0};
+        size_t n = fread(buf, 1, sizeof(buf) - 1, file);
+        fclose(file);
+
+        // comm can contain spaces and parentheses, state follows the last ')'
+        const char *end = strrchr(buf, ')');
+        if (n == 0 || !end || end[1] != ' ')
+            return 0;
+
+        return end[2];
+    }
+
+    bool allThreadsStopped(pid_t pid)
+    {
+        char path[64] = {0};
+        snprintf(path, sizeof(path), "/proc/%d/task", pid);
+
+        DIR *dir = opendir(path);
+        if (!dir)
+            return false;
+
+        bool stopped = true;
+        while (struct dirent *entry = readdir(dir))
+        {
+            if (entry->d_name[0] == '.')
+                continue;
+
+            // thread may have exited meanwhile, zombie and dead threads won't run again either
+            char state = threadState(pid, entry->d_name);
+            if (state != 0 && state != 'T' && state != 't' && state != 'Z' && state != 'X')
+            {
+                stopped = false;
+                break;
+            }
+        }
+
+        closedir(dir);
+        return stopped;
+    }
+}  // namespace
+
+bool UEProcessFreeze::Freeze(pid_t pid, int timeoutMS)
+{
+    if (pid <= 0 || _pid != 0)
+        return false;
+
+    installHandlers();
+
+    // publish before stopping so a signal in between still resumes the target
+    gFrozenPid = pid;
+    if (kill(pid, SIGSTOP) != 0)
+    {
+        int err = errno;
+        gFrozenPid = 0;
+        LOGE("Couldn't stop process %d error=%d | %s.", pid, err, strerror(err));
+        return false;
+    }
+    _pid = pid;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMS);
+    while (!allThreadsStopped(pid))
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            LOGE("Timed out waiting for process %d to stop.", pid);
+            Resume();
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+void UEProcessFreeze::Resume()
+{
+    if (_pid == 0)
+        return;
+
+    _pid = 0;
+    resumeFrozen();
+}
+
+#endif  // kEXECUTABLE
@@ -0,0 +1,29 @@
+#pragma once
+
+// Stopping the target is only possible from outside of it, executable build only
+#ifdef kEXECUTABLE
+
+#include <cstdint>
+#include <sys/types.h>
+
+// Keeps the target process stopped with SIGSTOP so memory doesn't change while dumping.
+// The target is resumed on Resume(), destruction, exit() and on fatal or termination signals of the dumper.
+class UEProcessFreeze
+{
+    pid_t _pid;
+
+public:
+    UEProcessFreeze() : _pid(0) {}
+    ~UEProcessFreeze() { Resume(); }
+
+    UEProcessFreeze(const UEProcessFreeze &) = delete;
+    UEProcessFreeze &operator=(const UEProcessFreeze &) = delete;
+
+    // stops pid and waits until all of its threads are stopped
+    bool Freeze(pid_t pid, int timeoutMS = 2000);
+    void Resume();
+
+    bool IsFrozen() const { return _pid != 0; }
+};
+
+#endif  // kEXECUTABLE
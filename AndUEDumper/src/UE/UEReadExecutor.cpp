@@ -0,0 +1,84 @@
+#include "UEReadExecutor.hpp"
+
+UEReadExecutor::UEReadExecutor(size_t threads) : _stop(false), _generation(0), _active(0), _job(nullptr), _count(0), _next(0)
+{
+    for (size_t i = 1; i < threads; i++)
+        _workers.emplace_back(&UEReadExecutor::workerLoop, this);
+}
+
+UEReadExecutor::~UEReadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wakeCv.notify_all();
+
+    for (auto &it : _workers)
+        it.join();
+}
+
+void UEReadExecutor::drain(const Job &job, size_t count)
+{
+    for (size_t i = _next.fetch_add(1, std::memory_order_relaxed); i < count; i = _next.fetch_add(1, std::memory_order_relaxed))
+        job(i);
+}
+
+void UEReadExecutor::workerLoop()
+{
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;)
+    {
+        _wakeCv.wait(lock, [&] { return _stop || _generation != seen; });
+        if (_stop) return;
+
+        seen = _generation;
+        // woke up after the run was already finished
+        if (!_job) continue;
+
+        const Job *job = _job;
+        const size_t count = _count;
+        _active++;
+
+        lock.unlock();
+        drain(*job, count);
+        lock.lock();
+
+        if (--_active == 0)
+            _doneCv.notify_all();
+    }
+}
+
+void UEReadExecutor::Run(size_t count, const Job &job)
+{
+    if (count == 0 || !job)
+        return;
+
+    if (_workers.empty() || count == 1 || !_runMutex.try_lock())
+    {
+        for (size_t i = 0; i < count; i++)
+            job(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &job;
+        _count = count;
+        _next = 0;
+        _generation++;
+    }
+    _wakeCv.notify_all();
+
+    drain(job, count);
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _doneCv.wait(lock, [&] { return _active == 0; });
+        _job = nullptr;
+        _count = 0;
+    }
+
+    _runMutex.unlock();
+}
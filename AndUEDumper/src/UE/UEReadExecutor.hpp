@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed size worker pool for independent remote read jobs.
+// Jobs of a Run() call are split between the workers and the calling thread,
+// a Run() issued while another one is in progress (nested or from another thread) runs on the calling thread.
+class UEReadExecutor
+{
+public:
+    using Job = std::function<void(size_t index)>;
+
+private:
+    std::vector<std::thread> _workers;
+
+    std::mutex _mutex;
+    std::condition_variable _wakeCv;
+    std::condition_variable _doneCv;
+    bool _stop;
+    uint64_t _generation;
+    size_t _active;  // workers currently draining jobs
+
+    const Job *_job;
+    size_t _count;
+    std::atomic<size_t> _next;
+
+    std::mutex _runMutex;
+
+    void workerLoop();
+    void drain(const Job &job, size_t count);
+
+public:
+    // threads is the total count including the calling thread
+    explicit UEReadExecutor(size_t threads);
+    ~UEReadExecutor();
+
+    UEReadExecutor(const UEReadExecutor &) = delete;
+    UEReadExecutor &operator=(const UEReadExecutor &) = delete;
+
+    size_t GetThreadCount() const { return _workers.size() + 1; }
+
+    // calls job(i) for i in [0, count), returns after all jobs finished
+    void Run(size_t count, const Job &job);
+};
@@ -0,0 +1,242 @@
+#include "UEReadTrace.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "../Utils/Logger.hpp"
+
+namespace UEReadTrace
+{
+    constexpr size_t kWriterBufferSize = 0x10000;
+
+    uint32_t Hash(const void *data, size_t len)
+    {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        uint32_t hash = 0x811C9DC5;
+        for (size_t i = 0; i < len; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 0x01000193;
+        }
+        return hash;
+    }
+
+    bool Writer::Open(const std::string &path)
+    {
+        Close();
+
+        _file = fopen(path.c_str(), "wb");
+        if (!_file)
+        {
+            int err = errno;
+            LOGE("Couldn't create trace file \"%s\" error=%d | %s.", path.c_str(), err, strerror(err));
+            return false;
+        }
+
+        Header header{};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.pointerSize = sizeof(void *);
+        if (fwrite(&header, 1, sizeof(header), _file) != sizeof(header))
+        {
+            LOGE("Failed to write trace file \"%s\".", path.c_str());
+            fclose(_file);
+            _file = nullptr;
+            return false;
+        }
+
+        _buffer.reserve(kWriterBufferSize);
+        _lastAddress = 0;
+        _records = 0;
+        return true;
+    }
+
+    void Writer::Close()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_file)
+            return;
+
+        flushLocked();
+        fclose(_file);
+        _file = nullptr;
+    }
+
+    void Writer::putVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            _buffer.push_back(uint8_t(value) | 0x80);
+            value >>= 7;
+        }
+        _buffer.push_back(uint8_t(value));
+    }
+
+    void Writer::flushLocked()
+    {
+        if (_file && !_buffer.empty())
+            fwrite(_buffer.data(), 1, _buffer.size(), _file);
+
+        _buffer.clear();
+    }
+
+    void Writer::SetPhase(const std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_file)
+            return;
+
+        const size_t len = std::min<size_t>(name.size(), 0xFF);
+        _buffer.push_back(RECORD_PHASE);
+        _buffer.push_back(uint8_t(len));
+        _buffer.insert(_buffer.end(), name.begin(), name.begin() + len);
+    }
+
+    void Writer::RecordRead(uintptr_t address, size_t len, const void *data, bool ok)
+    {
+        const uint32_t hash = (ok && data) ? Hash(data, len) : 0;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_file)
+            return;
+
+        // zigzag so nearby reads in both directions stay short
+        const int64_t delta = int64_t(address - _lastAddress);
+        _lastAddress = address;
+
+        _buffer.push_back(ok ? RECORD_READ_OK : RECORD_READ_FAILED);
+        putVarint((uint64_t(delta) << 1) ^ uint64_t(delta >> 63));
+        putVarint(len);
+        if (ok)
+        {
+            const uint8_t *h = reinterpret_cast<const uint8_t *>(&hash);
+            _buffer.insert(_buffer.end(), h, h + sizeof(hash));
+        }
+
+        _records++;
+        if (_buffer.size() >= kWriterBufferSize)
+            flushLocked();
+    }
+
+    void Writer::Flush()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        flushLocked();
+        if (_file)
+            fflush(_file);
+    }
+
+    bool Reader::Open(const std::string &path)
+    {
+        _data.clear();
+        _phases.clear();
+
+        FILE *file = fopen(path.c_str(), "rb");
+        if (!file)
+        {
+            int err = errno;
+            LOGE("Couldn't open trace file \"%s\" error=%d | %s.", path.c_str(), err, strerror(err));
+            return false;
+        }
+
+        uint8_t chunk[0x10000];
+        size_t n = 0;
+        while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+            _data.insert(_data.end(), chunk, chunk + n);
+        fclose(file);
+
+        Header header{};
+        if (_data.size() < sizeof(header))
+        {
+            LOGE("Invalid trace file \"%s\".", path.c_str());
+            return false;
+        }
+
+        memcpy(&header, _data.data(), sizeof(header));
+        if (header.magic != kMagic || header.version != kVersion || header.pointerSize != sizeof(void *))
+        {
+            LOGE("Invalid trace file \"%s\".", path.c_str());
+            _data.clear();
+            return false;
+        }
+
+        Rewind();
+        return true;
+    }
+
+    void Reader::Rewind()
+    {
+        _pos = sizeof(Header);
+        _lastAddress = 0;
+        _phase = 0;
+        _phases.assign(1, "");
+    }
+
+    bool Reader::getVarint(uint64_t *out)
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (_pos >= _data.size())
+                return false;
+
+            const uint8_t byte = _data[_pos++];
+            value |= uint64_t(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+            {
+                *out = value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Reader::Next(Record *out)
+    {
+        while (_pos < _data.size())
+        {
+            const uint8_t type = _data[_pos++];
+            if (type == RECORD_PHASE)
+            {
+                if (_pos >= _data.size() || _pos + 1 + _data[_pos] > _data.size())
+                    return false;
+
+                const size_t len = _data[_pos++];
+                _phases.emplace_back(reinterpret_cast<const char *>(&_data[_pos]), len);
+                _phase = _phases.size() - 1;
+                _pos += len;
+                continue;
+            }
+
+            if (type != RECORD_READ_OK && type != RECORD_READ_FAILED)
+                return false;
+
+            uint64_t zigzag = 0, len = 0;
+            if (!getVarint(&zigzag) || !getVarint(&len))
+                return false;
+
+            const int64_t delta = int64_t(zigzag >> 1) ^ -int64_t(zigzag & 1);
+            _lastAddress += uintptr_t(delta);
+
+            Record record{};
+            record.address = _lastAddress;
+            record.len = uint32_t(len);
+            record.ok = type == RECORD_READ_OK;
+            record.phase = _phase;
+
+            if (record.ok)
+            {
+                if (_pos + sizeof(record.hash) > _data.size())
+                    return false;
+
+                memcpy(&record.hash, &_data[_pos], sizeof(record.hash));
+                _pos += sizeof(record.hash);
+            }
+
+            *out = record;
+            return true;
+        }
+        return false;
+    }
+}  // namespace UEReadTrace
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Binary trace of remote reads, used to study access patterns and replay them offline.
+//
+// Layout:
+//   Header
+//   records, each starts with a type byte
+//     RECORD_PHASE:       u8 length, name
+//     RECORD_READ_OK:     varint zigzag address delta, varint length, u32 FNV-1a of the data
+//     RECORD_READ_FAILED: varint zigzag address delta, varint length
+namespace UEReadTrace
+{
+    constexpr uint64_t kMagic = 0x3143525445555546;  // "FUETRC1"
+    constexpr uint32_t kVersion = 1;
+
+    enum RecordType : uint8_t
+    {
+        RECORD_PHASE = 1,
+        RECORD_READ_OK = 2,
+        RECORD_READ_FAILED = 3,
+    };
+
+#pragma pack(push, 1)
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t pointerSize;
+    };
+#pragma pack(pop)
+
+    struct Record
+    {
+        uintptr_t address = 0;
+        uint32_t len = 0;
+        bool ok = false;
+        uint32_t hash = 0;
+        size_t phase = 0;  // index in Reader::GetPhases()
+    };
+
+    uint32_t Hash(const void *data, size_t len);
+
+    // thread safe, records are buffered and written on Flush/Close
+    class Writer
+    {
+        FILE *_file;
+        std::vector<uint8_t> _buffer;
+        uintptr_t _lastAddress;
+        uint64_t _records;
+        std::mutex _mutex;
+
+        void putVarint(uint64_t value);
+        void flushLocked();
+
+    public:
+        Writer() : _file(nullptr), _lastAddress(0), _records(0) {}
+        ~Writer() { Close(); }
+
+        Writer(const Writer &) = delete;
+        Writer &operator=(const Writer &) = delete;
+
+        bool Open(const std::string &path);
+        void Close();
+        bool IsOpen() const { return _file != nullptr; }
+
+        void SetPhase(const std::string &name);
+        // data may be nullptr when the read failed
+        void RecordRead(uintptr_t address, size_t len, const void *data, bool ok);
+
+        void Flush();
+
+        uint64_t GetRecordsCount() const { return _records; }
+    };
+
+    class Reader
+    {
+        std::vector<uint8_t> _data;
+        size_t _pos;
+        uintptr_t _lastAddress;
+        size_t _phase;
+        std::vector<std::string> _phases;
+
+        bool getVarint(uint64_t *out);
+
+    public:
+        Reader() : _pos(0), _lastAddress(0), _phase(0) {}
+
+        bool Open(const std::string &path);
+
+        // next read record, false at the end or on a corrupted record
+        bool Next(Record *out);
+        void Rewind();
+
+        // phases seen so far, index 0 is reads before the first phase
+        const std::vector<std::string> &GetPhases() const { return _phases; }
+    };
+}  // namespace UEReadTrace
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+#include "UEMemory.hpp"
+
+// Set of fields of a remote struct, fetched with a single read of the span covering all of them and decoded locally.
+//
+// Field types are declared at compile time, their offsets are only known at runtime (UE_Offsets),
+// so the covering span is computed once per field set in a Layout, after the offsets are set, and reused for every object.
+// The view keeps a pointer to its layout, the layout must outlive it.
+//
+// using View = UERemoteView<int32_t, uintptr_t>;
+// layout = std::make_unique<View::Layout>(std::array<uintptr_t, 2>{offsets->A, offsets->B});  // on init
+// View view(object, *layout);
+// int32_t a = view.Get<0>();
+template <typename... Fields>
+class UERemoteView
+{
+public:
+    static constexpr size_t kFieldsCount = sizeof...(Fields);
+    // larger spans are read field by field
+    static constexpr size_t kMaxSpanSize = 0x100;
+
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    static_assert(kFieldsCount > 0, "UERemoteView needs at least one field");
+    static_assert((std::is_trivially_copyable_v<Fields> && ...), "UERemoteView fields must be trivially copyable");
+
+    class Layout
+    {
+        std::array<uintptr_t, kFieldsCount> _offsets;
+        uintptr_t _begin;
+        size_t _size;
+
+    public:
+        static constexpr std::array<size_t, kFieldsCount> kSizes = {sizeof(Fields)...};
+
+        explicit Layout(const std::array<uintptr_t, kFieldsCount> &offsets) : _offsets(offsets), _begin(~uintptr_t(0)), _size(0)
+        {
+            uintptr_t end = 0;
+            for (size_t i = 0; i < kFieldsCount; i++)
+            {
+                _begin = std::min(_begin, _offsets[i]);
+                end = std::max(end, _offsets[i] + kSizes[i]);
+            }
+            _size = size_t(end - _begin);
+        }
+
+        uintptr_t offset(size_t i) const { return _offsets[i]; }
+        uintptr_t begin() const { return _begin; }
+        size_t size() const { return _size; }
+
+        bool fitsOneRead() const { return _size <= kMaxSpanSize; }
+    };
+
+private:
+    // fields packed back to back, used when the span doesn't fit or couldn't be read at once
+    static constexpr size_t kPackedSize = (sizeof(Fields) + ...);
+
+    static constexpr size_t packedOffset(size_t i)
+    {
+        constexpr size_t sizes[] = {sizeof(Fields)...};
+        size_t off = 0;
+        for (size_t j = 0; j < i; j++)
+            off += sizes[j];
+        return off;
+    }
+
+    const Layout *_layout;
+    bool _spanRead;
+    std::array<uint8_t, kMaxSpanSize> _span;
+    std::array<uint8_t, kPackedSize> _packed;
+
+public:
+    UERemoteView(const void *object, const Layout &layout) : _layout(&layout), _spanRead(false), _span{}, _packed{}
+    {
+        if (!object)
+            return;
+
+        const uint8_t *base = static_cast<const uint8_t *>(object);
+        if (layout.fitsOneRead() && UEMemory::vm_rpm_ptr(base + layout.begin(), _span.data(), layout.size()))
+        {
+            _spanRead = true;
+            return;
+        }
+
+        // span may reach unreadable memory past the fields we care about
+        UEMemory::ReadRequest requests[kFieldsCount];
+        for (size_t i = 0; i < kFieldsCount; i++)
+        {
+            requests[i].address = base + layout.offset(i);
+            requests[i].buffer = _packed.data() + packedOffset(i);
+            requests[i].len = Layout::kSizes[i];
+        }
+        UEMemory::vm_rpm_batch(requests, kFieldsCount);
+    }
+
+    // layout is referenced, not copied
+    UERemoteView(const void *object, Layout &&layout) = delete;
+
+    template <size_t I>
+    FieldType<I> Get() const
+    {
+        FieldType<I> value{};
+        if (_spanRead)
+            memcpy(&value, _span.data() + (_layout->offset(I) - _layout->begin()), sizeof(value));
+        else
+            memcpy(&value, _packed.data() + packedOffset(I), sizeof(value));
+        return value;
+    }
+};
@@ -0,0 +1,387 @@
+#include "UESnapshot.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../Utils/Logger.hpp"
+
+#include "UEGameProfile.hpp"
+
+using namespace UEMemory;
+
+namespace
+{
+    constexpr size_t kSnapshotPageSize = 0x1000;
+    constexpr size_t kSnapshotChunkSize = 0x100000;
+
+    bool isZeroPage(const uint8_t *page, size_t len)
+    {
+        const uint64_t *words = reinterpret_cast<const uint64_t *>(page);
+        for (size_t i = 0; i < len / sizeof(uint64_t); i++)
+        {
+            if (words[i] != 0) return false;
+        }
+        return true;
+    }
+
+    bool shouldSkipMap(const KittyMemoryEx::ProcMap &map)
+    {
+        if (!map.readable || map.length == 0)
+            return true;
+
+        // device maps (gpu etc.) are not useful and can fail or block on read
+        if (KittyUtils::String::StartsWith(map.pathname, "/dev/") && !KittyUtils::String::Contains(map.pathname, "ashmem"))
+            return true;
+
+        return map.pathname == "[vvar]";
+    }
+
+    class SnapshotWriter
+    {
+        FILE *_file;
+        uint64_t _dataOffset;
+        std::vector<UESnapshotFile::Region> _regions;
+
+    public:
+        UESnapshotFile::CaptureStats stats;
+
+        SnapshotWriter(FILE *file, uint64_t dataOffset) : _file(file), _dataOffset(dataOffset) {}
+
+        const std::vector<UESnapshotFile::Region> &regions() const { return _regions; }
+        uint64_t dataOffset() const { return _dataOffset; }
+
+        bool appendPage(uintptr_t address, const uint8_t *data, size_t len)
+        {
+            const bool zeroFill = isZeroPage(data, len);
+            const uint32_t flags = zeroFill ? UESnapshotFile::REGION_ZERO_FILL : 0;
+
+            if (!zeroFill && fwrite(data, 1, len, _file) != len)
+                return false;
+
+            bool merged = false;
+            if (!_regions.empty())
+            {
+                auto &last = _regions.back();
+                // data of consecutive non zero pages is also consecutive in file
+                if (last.start + last.size == address && last.flags == flags)
+                {
+                    last.size += len;
+                    merged = true;
+                }
+            }
+
+            if (!merged)
+            {
+                UESnapshotFile::Region region{};
+                region.start = address;
+                region.size = len;
+                region.dataOffset = zeroFill ? 0 : _dataOffset;
+                region.flags = flags;
+                _regions.push_back(region);
+                stats.regions++;
+            }
+
+            if (zeroFill)
+            {
+                stats.bytesZeroFill += len;
+            }
+            else
+            {
+                _dataOffset += len;
+                stats.bytesStored += len;
+            }
+
+            return true;
+        }
+
+        void skip(size_t len) { stats.bytesFailed += len; }
+    };
+}  // namespace
+
+bool UESnapshotFile::Capture(const std::string &path, const IGameProfile *profile, CaptureStats *outStats)
+{
+    if (!profile || path.empty())
+        return false;
+
+    const UEVars *vars = profile->GetUEVars();
+    ElfScanner ue_elf = profile->GetUnrealEngineELF();
+    if (!vars || !ue_elf.isValid())
+        return false;
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        int err = errno;
+        LOGE("Couldn't create snapshot file \"%s\" error=%d | %s.", path.c_str(), err, strerror(err));
+        return false;
+    }
+
+    Header header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.pointerSize = sizeof(void *);
+    header.e_machine = ue_elf.header().e_machine;
+    header.BaseAddress = vars->GetBaseAddress();
+    header.NamesPtr = vars->GetNamesPtr();
+    header.GUObjectsArrayPtr = vars->GetGUObjectsArrayPtr();
+    header.ObjObjectsPtr = vars->GetObjObjectsPtr();
+    header.ObjObjects_Objects = vars->GetObjObjects_Objects();
+    strncpy(header.package, kMgr.processName().c_str(), sizeof(header.package) - 1);
+    strncpy(header.libPath, ue_elf.filePath().c_str(), sizeof(header.libPath) - 1);
+
+    // header is rewritten at the end, data starts at the next page
+    std::vector<uint8_t> buffer(kSnapshotChunkSize, 0);
+    bool ok = fwrite(buffer.data(), 1, kSnapshotPageSize, file) == kSnapshotPageSize;
+
+    SnapshotWriter writer(file, kSnapshotPageSize);
+
+    for (const auto &map : KittyMemoryEx::getAllMaps(kMgr.processID()))
+    {
+        if (!ok) break;
+        if (shouldSkipMap(map)) continue;
+
+        for (uintptr_t chunk = map.startAddress; ok && chunk < map.endAddress; chunk += kSnapshotChunkSize)
+        {
+            const size_t chunkSize = std::min<size_t>(kSnapshotChunkSize, map.endAddress - chunk);
+            const bool chunkRead = kMgr.readMem(chunk, buffer.data(), chunkSize) == chunkSize;
+
+            for (size_t off = 0; ok && off < chunkSize; off += kSnapshotPageSize)
+            {
+                const size_t pageSize = std::min<size_t>(kSnapshotPageSize, chunkSize - off);
+                // some pages may be unreadable (guard pages etc.), retry them one by one
+                if (!chunkRead && kMgr.readMem(chunk + off, buffer.data() + off, pageSize) != pageSize)
+                {
+                    writer.skip(pageSize);
+                    continue;
+                }
+
+                ok = writer.appendPage(chunk + off, buffer.data() + off, pageSize);
+            }
+        }
+    }
+
+    if (ok)
+    {
+        const auto &regions = writer.regions();
+        header.regionsOffset = writer.dataOffset();
+        header.regionsCount = regions.size();
+        ok = fwrite(regions.data(), sizeof(Region), regions.size(), file) == regions.size();
+
+        std::vector<Segment> segments;
+        for (const auto &it : ue_elf.segments())
+        {
+            Segment seg{};
+            seg.start = it.startAddress;
+            seg.end = it.endAddress;
+            seg.offset = it.offset;
+            seg.readable = it.readable;
+            seg.writeable = it.writeable;
+            seg.executable = it.executable;
+            seg.is_private = it.is_private;
+            segments.push_back(seg);
+        }
+
+        header.segmentsOffset = header.regionsOffset + regions.size() * sizeof(Region);
+        header.segmentsCount = segments.size();
+        ok = ok && fwrite(segments.data(), sizeof(Segment), segments.size(), file) == segments.size();
+    }
+
+    ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, 1, sizeof(Header), file) == sizeof(Header);
+    ok = (fclose(file) == 0) && ok;
+
+    if (!ok)
+    {
+        LOGE("Failed to write snapshot file \"%s\".", path.c_str());
+        remove(path.c_str());
+        return false;
+    }
+
+    if (outStats)
+        *outStats = writer.stats;
+
+    return true;
+}
+
+bool UESnapshotFile::Open(const std::string &path)
+{
+    Close();
+
+    _fd = open(path.c_str(), O_RDONLY);
+    if (_fd < 0)
+    {
+        int err = errno;
+        LOGE("Couldn't open snapshot file \"%s\" error=%d | %s.", path.c_str(), err, strerror(err));
+        return false;
+    }
+
+    struct stat st{};
+    if (fstat(_fd, &st) != 0 || size_t(st.st_size) < sizeof(Header))
+    {
+        LOGE("Invalid snapshot file \"%s\".", path.c_str());
+        Close();
+        return false;
+    }
+
+    void *map = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (map == MAP_FAILED)
+    {
+        int err = errno;
+        LOGE("Couldn't map snapshot file \"%s\" error=%d | %s.", path.c_str(), err, strerror(err));
+        Close();
+        return false;
+    }
+
+    _map = static_cast<uint8_t *>(map);
+    _mapSize = size_t(st.st_size);
+
+    memcpy(&_header, _map, sizeof(Header));
+    _header.package[sizeof(_header.package) - 1] = '\0';
+    _header.libPath[sizeof(_header.libPath) - 1] = '\0';
+
+    // tables must fit in the file, checked without overflowing on corrupt counts
+    auto fitsInFile = [this](uint64_t offset, uint64_t count, size_t entrySize)
+    {
+        return offset <= _mapSize && count <= (_mapSize - offset) / entrySize;
+    };
+
+    if (_header.magic != kMagic || _header.version != kVersion ||
+        !fitsInFile(_header.regionsOffset, _header.regionsCount, sizeof(Region)) ||
+        !fitsInFile(_header.segmentsOffset, _header.segmentsCount, sizeof(Segment)))
+    {
+        LOGE("Invalid snapshot file \"%s\".", path.c_str());
+        Close();
+        return false;
+    }
+
+    _regions.resize(_header.regionsCount);
+    memcpy(_regions.data(), _map + _header.regionsOffset, _regions.size() * sizeof(Region));
+
+    _segments.resize(_header.segmentsCount);
+    memcpy(_segments.data(), _map + _header.segmentsOffset, _segments.size() * sizeof(Segment));
+
+    for (const auto &it : _regions)
+    {
+        // region data is stored before the regions table
+        if (!(it.flags & REGION_ZERO_FILL) && (it.dataOffset > _header.regionsOffset || it.size > _header.regionsOffset - it.dataOffset))
+        {
+            LOGE("Invalid snapshot file \"%s\".", path.c_str());
+            Close();
+            return false;
+        }
+    }
+
+    std::sort(_regions.begin(), _regions.end(), [](const Region &a, const Region &b)
+    {
+        return a.start < b.start;
+    });
+
+    return true;
+}
+
+void UESnapshotFile::Close()
+{
+    if (_map)
+        munmap(_map, _mapSize);
+
+    if (_fd >= 0)
+        close(_fd);
+
+    _fd = -1;
+    _map = nullptr;
+    _mapSize = 0;
+    _header = Header{};
+    _regions.clear();
+    _segments.clear();
+}
+
+std::vector<KittyMemoryEx::ProcMap> UESnapshotFile::GetSegments() const
+{
+    std::vector<KittyMemoryEx::ProcMap> segments;
+    for (const auto &it : _segments)
+    {
+        KittyMemoryEx::ProcMap map{};
+        map.startAddress = it.start;
+        map.endAddress = it.end;
+        map.length = size_t(it.end - it.start);
+        map.offset = it.offset;
+        map.protection = (it.readable ? PROT_READ : 0) | (it.writeable ? PROT_WRITE : 0) | (it.executable ? PROT_EXEC : 0);
+        map.readable = it.readable;
+        map.writeable = it.writeable;
+        map.executable = it.executable;
+        map.is_private = it.is_private;
+        map.is_shared = !it.is_private;
+        map.is_ro = it.readable && !it.writeable && !it.executable;
+        map.is_rw = it.readable && it.writeable && !it.executable;
+        map.is_rx = it.readable && !it.writeable && it.executable;
+        map.pathname = _header.libPath;
+        segments.push_back(map);
+    }
+    return segments;
+}
+
+const UESnapshotFile::Region *UESnapshotFile::findRegion(uintptr_t address) const
+{
+    auto it = std::upper_bound(_regions.begin(), _regions.end(), address, [](uintptr_t addr, const Region &region)
+    {
+        return addr < region.start;
+    });
+
+    if (it == _regions.begin())
+        return nullptr;
+
+    --it;
+    if (address >= it->start + it->size)
+        return nullptr;
+
+    return &(*it);
+}
+
+size_t UESnapshotFile::Read(uintptr_t address, void *buffer, size_t len) const
+{
+    if (!_map || !buffer || len == 0)
+        return 0;
+
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+    size_t bytesRead = 0;
+
+    while (bytesRead < len)
+    {
+        const uintptr_t current = address + bytesRead;
+        const Region *region = findRegion(current);
+        if (!region) break;
+
+        const size_t regionOffset = size_t(current - region->start);
+        const size_t toCopy = std::min<size_t>(len - bytesRead, region->size - regionOffset);
+
+        if (region->flags & REGION_ZERO_FILL)
+            memset(out + bytesRead, 0, toCopy);
+        else
+            memcpy(out + bytesRead, _map + region->dataOffset + regionOffset, toCopy);
+
+        bytesRead += toCopy;
+    }
+
+    return bytesRead;
+}
+
+bool UESnapshotFile::IsReadable(uintptr_t address, size_t len) const
+{
+    if (!_map || address == 0)
+        return false;
+
+    uintptr_t current = address;
+    const uintptr_t end = address + len;
+    do
+    {
+        const Region *region = findRegion(current);
+        if (!region) return false;
+
+        current = uintptr_t(region->start + region->size);
+    } while (current < end);
+
+    return true;
+}
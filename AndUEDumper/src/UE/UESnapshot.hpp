@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "UEMemory.hpp"
+
+class IGameProfile;
+
+// On-disk copy of the target readable memory and UE vars, used to replay a dump offline.
+//
+// Layout:
+//   Header
+//   regions data (page aligned)
+//   Region[regionsCount]
+//   Segment[segmentsCount]
+class UESnapshotFile : public UEMemory::IMemoryBackend
+{
+public:
+    static constexpr uint64_t kMagic = 0x3150414E53455546;  // "FUESNAP1"
+    static constexpr uint32_t kVersion = 1;
+
+    enum RegionFlags : uint32_t
+    {
+        REGION_ZERO_FILL = 1 << 0,  // all zero pages, no data stored
+    };
+
+#pragma pack(push, 1)
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t pointerSize;
+        uint32_t e_machine;
+        uint32_t reserved;
+        uint64_t BaseAddress;
+        uint64_t NamesPtr;
+        uint64_t GUObjectsArrayPtr;
+        uint64_t ObjObjectsPtr;
+        uint64_t ObjObjects_Objects;
+        uint64_t regionsOffset;
+        uint64_t regionsCount;
+        uint64_t segmentsOffset;
+        uint64_t segmentsCount;
+        char package[0x100];
+        char libPath[0x100];
+    };
+
+    struct Region
+    {
+        uint64_t start;
+        uint64_t size;
+        uint64_t dataOffset;
+        uint32_t flags;
+        uint32_t reserved;
+    };
+
+    struct Segment
+    {
+        uint64_t start;
+        uint64_t end;
+        uint64_t offset;
+        uint8_t readable;
+        uint8_t writeable;
+        uint8_t executable;
+        uint8_t is_private;
+        uint32_t reserved;
+    };
+#pragma pack(pop)
+
+    struct CaptureStats
+    {
+        size_t regions = 0;
+        size_t bytesStored = 0;
+        size_t bytesZeroFill = 0;
+        size_t bytesFailed = 0;
+    };
+
+private:
+    int _fd;
+    uint8_t *_map;
+    size_t _mapSize;
+    Header _header;
+    std::vector<Region> _regions;  // sorted by start
+    std::vector<Segment> _segments;
+
+    const Region *findRegion(uintptr_t address) const;
+
+public:
+    UESnapshotFile() : _fd(-1), _map(nullptr), _mapSize(0), _header{} {}
+    ~UESnapshotFile() { Close(); }
+
+    UESnapshotFile(const UESnapshotFile &) = delete;
+    UESnapshotFile &operator=(const UESnapshotFile &) = delete;
+
+    // captures readable maps of the target process and the profile UE vars, profile must be initialized
+    static bool Capture(const std::string &path, const IGameProfile *profile, CaptureStats *outStats = nullptr);
+
+    bool Open(const std::string &path);
+    void Close();
+
+    bool IsOpen() const { return _map != nullptr; }
+
+    const Header &GetHeader() const { return _header; }
+    std::string GetPackage() const { return _header.package; }
+    std::string GetLibPath() const { return _header.libPath; }
+
+    const std::vector<Region> &GetRegions() const { return _regions; }
+
+    // UE ELF segments as they were mapped in the target
+    std::vector<KittyMemoryEx::ProcMap> GetSegments() const;
+
+    size_t Read(uintptr_t address, void *buffer, size_t len) const override;
+    bool IsReadable(uintptr_t address, size_t len) const override;
+};
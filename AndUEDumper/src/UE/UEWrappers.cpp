@@ -1,22 +1,63 @@
 #include "UEWrappers.hpp"
 using namespace UEMemory;
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <unordered_set>
+
 #include <hash/hash.h>
 
 #include "UEGameProfile.hpp"
+#include "UERemoteView.hpp"
 
 #include <utfcpp/unchecked.h>
 
+using FNameView = UERemoteView<int32_t, int32_t>;
+using PropLayoutView = UERemoteView<int32_t, int32_t, int32_t, uint64_t>;
+using StructInfoView = UERemoteView<uint8_t *, uint8_t *, uint8_t *, int32_t>;
+using FunctionInfoView = UERemoteView<uintptr_t, int8_t, int16_t, uint32_t>;
+
+// remote view layouts of the wrappers, their spans only depend on the offsets
+struct UEViewLayouts
+{
+    FNameView::Layout FName;
+    PropLayoutView::Layout UProperty;
+    PropLayoutView::Layout FProperty;
+    StructInfoView::Layout UStruct;
+    FunctionInfoView::Layout UFunction;
+
+    explicit UEViewLayouts(const UE_Offsets &off)
+        : FName({off.FName.ComparisonIndex, off.FName.Number}),
+          UProperty({off.UProperty.ArrayDim, off.UProperty.ElementSize, off.UProperty.Offset_Internal, off.UProperty.PropertyFlags}),
+          FProperty({off.FProperty.ArrayDim, off.FProperty.ElementSize, off.FProperty.Offset_Internal, off.FProperty.PropertyFlags}),
+          // missing fields alias SuperStruct so they don't widen the span
+          UStruct({off.UStruct.SuperStruct,
+                   off.UStruct.Children > 0 ? off.UStruct.Children : off.UStruct.SuperStruct,
+                   off.UStruct.ChildProperties > 0 ? off.UStruct.ChildProperties : off.UStruct.SuperStruct,
+                   off.UStruct.PropertiesSize}),
+          UFunction({off.UFunction.Func, off.UFunction.NumParams, off.UFunction.ParamSize, off.UFunction.EFunctionFlags})
+    {
+    }
+};
+
 namespace UEWrappers
 {
     UEVars const *GUVars = nullptr;
     std::unique_ptr<UE_UObjectArray> pObjectsArray = nullptr;
+    UENameArena NameArena;
+    UEDisplayNameCache DisplayNames;
+    // built on Init from the offsets of the current vars
+    std::unique_ptr<UEViewLayouts> pViewLayouts = nullptr;
 
     void Init(const UEVars *vars)
     {
         if (vars)
         {
             GUVars = vars;
+            DisplayNames.Clear();
+            NameArena.Clear();
+            pViewLayouts = std::make_unique<UEViewLayouts>(*vars->GetOffsets());
             if (pObjectsArray.get())
             {
                 pObjectsArray.reset();
@@ -30,8 +71,45 @@ namespace UEWrappers
     UE_Offsets *GetOffsets() { return GUVars ? GUVars->GetOffsets() : nullptr; }
     std::string GetNameByID(int32_t id) { return GUVars ? GUVars->GetNameByID(id) : ""; }
     UE_UObjectArray *GetObjects() { return pObjectsArray.get(); }
+
+    std::atomic<bool> bObjectValidation{false};
+    std::atomic<uint64_t> validatedObjects{0};
+    std::atomic<uint64_t> retriedObjects{0};
+    std::atomic<uint64_t> skippedObjects{0};
+
+    void SetObjectValidation(bool enabled) { bObjectValidation = enabled; }
+    bool IsObjectValidationEnabled() { return bObjectValidation; }
+
+    ObjectValidationStats GetObjectValidationStats()
+    {
+        ObjectValidationStats stats;
+        stats.validated = validatedObjects;
+        stats.retries = retriedObjects;
+        stats.skipped = skippedObjects;
+        return stats;
+    }
+
+    void ResetObjectValidationStats()
+    {
+        validatedObjects = 0;
+        retriedObjects = 0;
+        skippedObjects = 0;
+    }
+
+    std::atomic<bool> bStaticTarget{false};
+
+    void SetStaticTarget(bool isStatic) { bStaticTarget = isStatic; }
+    bool IsStaticTarget() { return bStaticTarget; }
+
+    UENameArena::Stats GetNameArenaStats() { return NameArena.GetStats(); }
+    UEDisplayNameCache::Stats GetDisplayNamesStats() { return DisplayNames.GetStats(); }
 }  // namespace UEWrappers
 
+bool UEObjectStamp::operator==(const UEObjectStamp &other) const
+{
+    return cls == other.cls && outer == other.outer && name == other.name && index == other.index && memcmp(item, other.item, sizeof(item)) == 0;
+}
+
 std::string FString::ToString() const
 {
     if (!IsValid()) return "";
@@ -44,6 +122,19 @@ std::string FString::ToString() const
     return result;
 }
 
+static UEPropLayout ReadPropLayout(const uint8_t *object, const PropLayoutView::Layout &viewLayout)
+{
+    UEPropLayout layout{};
+    if (!object) return layout;
+
+    PropLayoutView view(object, viewLayout);
+    layout.ArrayDim = view.Get<0>();
+    layout.ElementSize = view.Get<1>();
+    layout.Offset = view.Get<2>();
+    layout.PropertyFlags = view.Get<3>();
+    return layout;
+}
+
 int32_t UE_UObjectArray::GetNumElements() const
 {
     if (UEWrappers::GUVars->GetObjObjectsPtr() == 0)
@@ -52,66 +143,235 @@ int32_t UE_UObjectArray::GetNumElements() const
     return vm_rpm_ptr<int32_t>((void *)(UEWrappers::GUVars->GetObjObjectsPtr() + UEWrappers::GetOffsets()->TUObjectArray.NumElements));
 }
 
-uint8_t *UE_UObjectArray::GetObjectPtr(int32_t id) const
+uintptr_t UE_UObjectArray::GetObjectItemAddress(int32_t id) const
 {
     if (id < 0 || id >= GetNumElements() || !Objects)
-        return nullptr;
+        return 0;
 
     if (UEWrappers::GetOffsets()->TUObjectArray.NumElementsPerChunk <= 0)
     {
-        return vm_rpm_ptr<uint8_t *>((void *)((uintptr_t)Objects + (id * UEWrappers::GetOffsets()->FUObjectItem.Size) + UEWrappers::GetOffsets()->FUObjectItem.Object));
+        return (uintptr_t)Objects + (id * UEWrappers::GetOffsets()->FUObjectItem.Size);
     }
 
     const int32_t NumElementsPerChunk = UEWrappers::GetOffsets()->TUObjectArray.NumElementsPerChunk;
     const int32_t chunkIndex = id / NumElementsPerChunk;
     const int32_t withinChunkIndex = id % NumElementsPerChunk;
 
-    // if (chunkIndex >= NumChunks) return nullptr;
+    // if (chunkIndex >= NumChunks) return 0;
 
     uint8_t *chunk = vm_rpm_ptr<uint8_t *>(Objects + chunkIndex);
     if (!chunk)
+        return 0;
+
+    return (uintptr_t)chunk + (withinChunkIndex * UEWrappers::GetOffsets()->FUObjectItem.Size);
+}
+
+uint8_t *UE_UObjectArray::GetObjectPtr(int32_t id) const
+{
+    uintptr_t item = GetObjectItemAddress(id);
+    if (!item)
         return nullptr;
 
-    return vm_rpm_ptr<uint8_t *>(chunk + (withinChunkIndex * UEWrappers::GetOffsets()->FUObjectItem.Size) + UEWrappers::GetOffsets()->FUObjectItem.Object);
+    return vm_rpm_ptr<uint8_t *>((void *)(item + UEWrappers::GetOffsets()->FUObjectItem.Object));
+}
+
+int32_t UE_UObjectArray::GetObjectPtrs(int32_t start, int32_t count, uint8_t **out) const
+{
+    if (!out || count <= 0) return 0;
+
+    memset(out, 0, count * sizeof(uint8_t *));
+
+    const int32_t numElements = GetNumElements();
+    if (!Objects || start < 0 || start >= numElements) return 0;
+
+    count = std::min(count, numElements - start);
+
+    const uintptr_t itemSize = UEWrappers::GetOffsets()->FUObjectItem.Size;
+    const uintptr_t itemObject = UEWrappers::GetOffsets()->FUObjectItem.Object;
+    const int32_t NumElementsPerChunk = UEWrappers::GetOffsets()->TUObjectArray.NumElementsPerChunk;
+
+    std::vector<UEMemory::ReadRequest> requests(count);
+
+    if (NumElementsPerChunk <= 0)
+    {
+        for (int32_t i = 0; i < count; i++)
+        {
+            requests[i].address = (void *)((uintptr_t)Objects + ((start + i) * itemSize) + itemObject);
+            requests[i].buffer = &out[i];
+            requests[i].len = sizeof(uint8_t *);
+        }
+        return int32_t(vm_rpm_batch(requests));
+    }
+
+    const int32_t firstChunk = start / NumElementsPerChunk;
+    const int32_t lastChunk = (start + count - 1) / NumElementsPerChunk;
+
+    std::vector<uint8_t *> chunks(lastChunk - firstChunk + 1, nullptr);
+    if (!vm_rpm_ptr(Objects + firstChunk, chunks.data(), chunks.size() * sizeof(uint8_t *)))
+    {
+        // chunks table may end close to a page boundary, fallback to single reads
+        for (size_t i = 0; i < chunks.size(); i++)
+            chunks[i] = vm_rpm_ptr<uint8_t *>(Objects + firstChunk + i);
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        const int32_t id = start + i;
+        uint8_t *chunk = chunks[(id / NumElementsPerChunk) - firstChunk];
+        if (!chunk) continue;
+
+        requests[i].address = chunk + ((id % NumElementsPerChunk) * itemSize) + itemObject;
+        requests[i].buffer = &out[i];
+        requests[i].len = sizeof(uint8_t *);
+    }
+
+    return int32_t(vm_rpm_batch(requests));
 }
 
 void UE_UObjectArray::ForEachObject(const std::function<bool(UE_UObject)> &callback) const
 {
     if (!callback) return;
 
-    for (int32_t i = 0; i < GetNumElements(); i++)
+    std::vector<uint8_t *> objects(kObjectsBatchSize);
+
+    const int32_t numElements = GetNumElements();
+    for (int32_t start = 0; start < numElements; start += kObjectsBatchSize)
     {
-        uint8_t *object = GetObjectPtr(i);
-        if (!object) continue;
+        const int32_t count = std::min(kObjectsBatchSize, numElements - start);
+        GetObjectPtrs(start, count, objects.data());
+
+        for (int32_t i = 0; i < count; i++)
+        {
+            if (!objects[i]) continue;
 
-        if (callback(object)) return;
+            if (callback(objects[i])) return;
+        }
     }
 }
 
-void UE_UObjectArray::ForEachObjectOfClass(const UE_UClass &cmp, const std::function<bool(UE_UObject)> &callback) const
+bool UE_UObjectArray::ReadObjectStamp(const UE_UObject &object, UEObjectStamp *out) const
 {
-    if (!cmp || !callback) return;
+    if (!object || !out)
+        return false;
+
+    *out = UEObjectStamp{};
+
+    uint8_t *address = object.GetAddress();
+
+    // stamps must come from the target, not from cached pages
+    UEMemory::ReadRequest header[] = {
+        {address + UEWrappers::GetOffsets()->UObject.ClassPrivate, &out->cls, sizeof(out->cls)},
+        {address + UEWrappers::GetOffsets()->UObject.OuterPrivate, &out->outer, sizeof(out->outer)},
+        {address + UEWrappers::GetOffsets()->UObject.NamePrivate, &out->name, sizeof(out->name)},
+        {address + UEWrappers::GetOffsets()->UObject.InternalIndex, &out->index, sizeof(out->index)},
+    };
+    if (vm_rpm_batch_uncached(header, sizeof(header) / sizeof(header[0])) != sizeof(header) / sizeof(header[0]))
+        return false;
+
+    // index self check, object must still own its slot
+    uintptr_t item = GetObjectItemAddress(out->index);
+    if (!item)
+        return false;
+
+    const size_t itemSize = std::min<size_t>(UEWrappers::GetOffsets()->FUObjectItem.Size, UEObjectStamp::kMaxItemSize);
+    const uintptr_t itemObject = UEWrappers::GetOffsets()->FUObjectItem.Object;
+    if (itemSize < itemObject + sizeof(void *))
+        return false;
+
+    UEMemory::ReadRequest itemRequest{(const void *)item, out->item, itemSize};
+    if (vm_rpm_batch_uncached(&itemRequest, 1) != 1)
+        return false;
+
+    uint8_t *slotObject = nullptr;
+    memcpy(&slotObject, out->item + itemObject, sizeof(slotObject));
+    return slotObject == address && out->cls != nullptr;
+}
 
-    for (int32_t i = 0; i < GetNumElements(); i++)
+bool UE_UObjectArray::ProcessValidated(const UE_UObject &object, const std::function<void()> &process) const
+{
+    if (!UEWrappers::IsObjectValidationEnabled())
     {
-        UE_UObject object = GetObjectPtr(i);
-        if (object && object.IsA(cmp))
+        process();
+        return true;
+    }
+
+    for (int attempt = 0; attempt <= kMaxValidationRetries; attempt++)
+    {
+        if (attempt > 0)
+            UEWrappers::retriedObjects++;
+
+        UEObjectStamp before{}, after{};
+        if (!ReadObjectStamp(object, &before))
+            break;
+
+        process();
+
+        if (ReadObjectStamp(object, &after) && before == after)
         {
-            if (callback(object)) return;
+            UEWrappers::validatedObjects++;
+            return true;
         }
     }
+
+    UEWrappers::skippedObjects++;
+    return false;
 }
 
-bool UE_UObjectArray::IsObject(const UE_UObject &address) const
+bool UE_UObjectArray::ProcessValidated(int32_t id, const std::function<void(UE_UObject)> &process) const
 {
-    for (int32_t i = 0; i < GetNumElements(); i++)
+    if (!UEWrappers::IsObjectValidationEnabled())
+    {
+        process(GetObjectPtr(id));
+        return true;
+    }
+
+    for (int attempt = 0; attempt <= kMaxValidationRetries; attempt++)
     {
-        UE_UObject object = GetObjectPtr(i);
-        if (address == object) return true;
+        if (attempt > 0)
+            UEWrappers::retriedObjects++;
+
+        // slot may have been reused by a new object meanwhile
+        UE_UObject object = GetObjectPtr(id);
+        UEObjectStamp before{}, after{};
+        if (!ReadObjectStamp(object, &before) || before.index != id)
+            break;
+
+        process(object);
+
+        if (ReadObjectStamp(object, &after) && before == after)
+        {
+            UEWrappers::validatedObjects++;
+            return true;
+        }
     }
+
+    UEWrappers::skippedObjects++;
     return false;
 }
 
+void UE_UObjectArray::ForEachObjectOfClass(const UE_UClass &cmp, const std::function<bool(UE_UObject)> &callback) const
+{
+    if (!cmp || !callback) return;
+
+    ForEachObject([&](UE_UObject object)
+    {
+        return object.IsA(cmp) && callback(object);
+    });
+}
+
+bool UE_UObjectArray::IsObject(const UE_UObject &address) const
+{
+    if (!address) return false;
+
+    bool found = false;
+    ForEachObject([&](UE_UObject object)
+    {
+        found = (address == object);
+        return found;
+    });
+    return found;
+}
+
 int UE_FName::GetNumber() const
 {
     if (!object || UEWrappers::GetOffsets()->Config.isUsingOutlineNumberName)
@@ -122,35 +382,144 @@ int UE_FName::GetNumber() const
 
 std::string UE_FName::GetName() const
 {
-    if (!object) return "None";
+    return std::string(GetNameView());
+}
+
+bool UE_FName::GetIndex(int32_t *index, int32_t *number) const
+{
+    if (!object) return false;
 
-    uintptr_t nameID_offset = UEWrappers::GetOffsets()->FName.ComparisonIndex;
+    const auto *offsets = UEWrappers::GetOffsets();
+    uintptr_t nameID_offset = offsets->FName.ComparisonIndex;
     // if (UEWrappers::GetOffsets()->isUsingCasePreservingName)
     //   nameID_offset = UEWrappers::GetOffsets()->FName.DisplayIndex;
 
-    int32_t index = 0;
-    if (!vm_rpm_ptr(object + nameID_offset, &index, sizeof(int32_t)) || index < 0)
+    *number = 0;
+    if (offsets->Config.isUsingOutlineNumberName)
+        return vm_rpm_ptr(object + nameID_offset, index, sizeof(int32_t));
+
+    // index and number with one read
+    FNameView view(object, UEWrappers::pViewLayouts->FName);
+    *index = view.Get<0>();
+    *number = view.Get<1>();
+    return true;
+}
+
+std::string_view UE_FName::GetNameView() const
+{
+    int32_t index = 0, number = 0;
+    if (!GetIndex(&index, &number) || index < 0)
         return "None";
 
-    std::string name = UEWrappers::GetNameByID(index);
+    return GetNameView(index, number);
+}
+
+std::string UE_FName::GetName(int32_t index, int32_t number)
+{
+    return std::string(GetNameView(index, number));
+}
+
+std::string_view UE_FName::GetNameView(int32_t index, int32_t number)
+{
+    if (index < 0) return "None";
+
+    if (UEWrappers::GetOffsets()->Config.isUsingOutlineNumberName)
+        number = 0;
+
+    std::string_view cached;
+    if (UEWrappers::DisplayNames.Get(index, number, &cached))
+        return cached;
+
+    // formatted in place, only names seen for the first time are copied into the arena
+    thread_local std::string name;
+    name = UEWrappers::GetNameByID(index);
     if (name.empty()) return "None";
 
-    if (!UEWrappers::GetOffsets()->Config.isUsingOutlineNumberName)
+    if (number > 0)
     {
-        int32_t number = GetNumber();
-        if (number > 0)
-        {
-            name += '_' + std::to_string(number - 1);
-        }
+        char digits[16];
+        auto res = std::to_chars(digits, digits + sizeof(digits), number - 1);
+        name += '_';
+        name.append(digits, res.ptr);
     }
 
-    auto pos = name.rfind('/');
-    if (pos != std::string::npos)
+    std::string_view view = name;
+    auto pos = view.rfind('/');
+    if (pos != std::string_view::npos)
     {
-        name = name.substr(pos + 1);
+        view.remove_prefix(pos + 1);
     }
 
-    return name;
+    std::string_view interned = UEWrappers::NameArena.Intern(view);
+    UEWrappers::DisplayNames.Put(index, number, interned);
+    return interned;
+}
+
+UE_FNameQuery::UE_FNameQuery(std::string_view name) : _resolved(false)
+{
+    resolve(name);
+
+    // on a running target the name may be added after the index was built, compare strings then
+    if (_resolved && _names.empty() && !UEWrappers::IsStaticTarget())
+        _resolved = false;
+}
+
+void UE_FNameQuery::resolve(std::string_view name)
+{
+    const auto *vars = UEWrappers::GetUEVars();
+    if (!vars || name.empty())
+        return;
+
+    std::vector<int32_t> ids;
+    if (!vars->FindNameIDs(name, &ids))
+        return;
+
+    _resolved = true;
+
+    const bool outlineNumbers = UEWrappers::GetOffsets()->Config.isUsingOutlineNumberName;
+    for (int32_t id : ids)
+    {
+        // a path name may be displayed the same as a plain one, keep only ids displayed exactly as name
+        if (UE_FName::GetNameView(id, 0) == name)
+            _names.emplace_back(id, 0);
+    }
+
+    // "Base_N" is also Base with number N + 1, unless numbers are part of the entries
+    const size_t sep = name.rfind('_');
+    if (outlineNumbers || sep == std::string_view::npos || sep + 1 == name.size())
+        return;
+
+    const std::string_view digits = name.substr(sep + 1);
+    int32_t value = 0;
+    auto res = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+    // UE keeps suffixes with leading zeros as part of the name
+    if (res.ec != std::errc() || res.ptr != digits.data() + digits.size() || value < 0 || value == INT32_MAX || (digits.size() > 1 && digits[0] == '0'))
+        return;
+
+    const std::string_view base = name.substr(0, sep);
+    ids.clear();
+    vars->FindNameIDs(base, &ids);
+    for (int32_t id : ids)
+    {
+        if (UE_FName::GetNameView(id, 0) == base)
+            _names.emplace_back(id, value + 1);
+    }
+}
+
+bool UE_FNameQuery::Matches(int32_t index, int32_t number) const
+{
+    for (const auto &name : _names)
+    {
+        if (name.first == index && name.second == number)
+            return true;
+    }
+    return false;
+}
+
+bool UE_FNameQuery::Matches(const UE_FName &name) const
+{
+    int32_t index = 0, number = 0;
+    return name.GetIndex(&index, &number) && Matches(index, number);
 }
 
 EObjectFlags UE_UObject::GetFlags() const
@@ -193,26 +562,60 @@ UE_UObject UE_UObject::GetPackageObject() const
     return package;
 }
 
+UE_FName UE_UObject::GetFName() const
+{
+    if (!object) return UE_FName();
+
+    return UE_FName(object + UEWrappers::GetOffsets()->UObject.NamePrivate);
+}
+
 std::string UE_UObject::GetName() const
+{
+    return std::string(GetNameView());
+}
+
+std::string_view UE_UObject::GetNameView() const
 {
     if (!object) return "";
 
-    auto fname = UE_FName(object + UEWrappers::GetOffsets()->UObject.NamePrivate);
-    return fname.GetName();
+    return GetFName().GetNameView();
 }
 
 std::string UE_UObject::GetFullName() const
 {
-    if (!object) return "";
+    std::string name;
+    GetFullName(&name);
+    return name;
+}
+
+void UE_UObject::GetFullName(std::string *out) const
+{
+    out->clear();
+    if (!object) return;
 
-    std::string temp;
+    // outers innermost first, joined outermost first
+    thread_local std::vector<std::string_view> outers;
+    outers.clear();
+
+    size_t len = 0;
     for (auto outer = GetOuter(); outer; outer = outer.GetOuter())
     {
-        temp = outer.GetName() + "." + temp;
+        outers.push_back(outer.GetNameView());
+        len += outers.back().size() + 1;
     }
-    UE_UClass objectClass = GetClass();
-    std::string name = objectClass.GetName() + " " + temp + GetName();
-    return name;
+
+    std::string_view className = GetClass().GetNameView();
+    std::string_view name = GetNameView();
+    out->reserve(className.size() + 1 + len + name.size());
+
+    out->append(className);
+    out->push_back(' ');
+    for (auto it = outers.rbegin(); it != outers.rend(); ++it)
+    {
+        out->append(*it);
+        out->push_back('.');
+    }
+    out->append(name);
 }
 
 std::string UE_UObject::GetCppName() const
@@ -246,7 +649,7 @@ std::string UE_UObject::GetCppName() const
         name = "F";
     }
 
-    name += GetName();
+    name += GetNameView();
     return name;
 }
 
@@ -327,6 +730,11 @@ uint64_t IUProperty::GetPropertyFlags() const
     return ((UE_UProperty *)(this->prop))->GetPropertyFlags();
 }
 
+UEPropLayout IUProperty::GetLayout() const
+{
+    return ((UE_UProperty *)(this->prop))->GetLayout();
+}
+
 std::pair<UEPropertyType, std::string> IUProperty::GetType() const
 {
     return ((UE_UProperty *)(this->prop))->GetType();
@@ -357,6 +765,11 @@ uint64_t UE_UProperty::GetPropertyFlags() const
     return vm_rpm_ptr<uint64_t>(object + UEWrappers::GetOffsets()->UProperty.PropertyFlags);
 }
 
+UEPropLayout UE_UProperty::GetLayout() const
+{
+    return ReadPropLayout(object, UEWrappers::pViewLayouts->UProperty);
+}
+
 std::pair<UEPropertyType, std::string> UE_UProperty::GetType() const
 {
     if (IsA<UE_UDoubleProperty>())
@@ -501,11 +914,75 @@ UE_UField UE_UStruct::GetChildren() const
     return {};
 }
 
+template <typename T>
+static std::vector<T> PrefetchFieldChain(T node, size_t footprint, uintptr_t nextOffset)
+{
+    // a corrupt next pointer can loop or run on through garbage, no real struct has this many fields
+    constexpr size_t kMaxChainNodes = 4096;
+
+    std::vector<T> nodes;
+    std::unordered_set<uint8_t *> seen;
+    while (node && nodes.size() < kMaxChainNodes && seen.insert(node.GetAddress()).second)
+    {
+        nodes.push_back(node);
+
+        // footprint includes subclass fields after the base property, retry with the base size near region end
+        const uint8_t *local = Prefetch::Add(node.GetAddress(), footprint);
+        if (!local)
+            local = Prefetch::Add(node.GetAddress(), nextOffset + sizeof(void *));
+
+        uint8_t *next = nullptr;
+        if (local)
+            memcpy(&next, local + nextOffset, sizeof(next));
+        else
+            next = node.GetNext().GetAddress();
+
+        node = T(next);
+    }
+    return nodes;
+}
+
+std::vector<UE_FField> UE_UStruct::PrefetchChildProperties() const
+{
+    return PrefetchChildProperties(GetChildProperties());
+}
+
+std::vector<UE_UField> UE_UStruct::PrefetchChildren() const
+{
+    return PrefetchChildren(GetChildren());
+}
+
+std::vector<UE_FField> UE_UStruct::PrefetchChildProperties(UE_FField head)
+{
+    const auto *offsets = UEWrappers::GetOffsets();
+    return PrefetchFieldChain(head, offsets->FProperty.Size + sizeof(void *) * 2, offsets->FField.Next);
+}
+
+std::vector<UE_UField> UE_UStruct::PrefetchChildren(UE_UField head)
+{
+    const auto *offsets = UEWrappers::GetOffsets();
+    return PrefetchFieldChain(head, offsets->UProperty.Size + sizeof(void *) * 2, offsets->UField.Next);
+}
+
 int32_t UE_UStruct::GetSize() const
 {
     return vm_rpm_ptr<int32_t>(object + UEWrappers::GetOffsets()->UStruct.PropertiesSize);
 }
 
+UEStructInfo UE_UStruct::GetInfo() const
+{
+    UEStructInfo info{};
+    if (!object) return info;
+
+    const auto &off = UEWrappers::GetOffsets()->UStruct;
+    StructInfoView view(object, UEWrappers::pViewLayouts->UStruct);
+    info.Super = view.Get<0>();
+    info.Children = off.Children > 0 ? view.Get<1>() : nullptr;
+    info.ChildProperties = off.ChildProperties > 0 ? view.Get<2>() : nullptr;
+    info.Size = view.Get<3>();
+    return info;
+}
+
 UE_UClass UE_UStruct::StaticClass()
 {
     static auto obj = UEWrappers::GetObjects()->FindObject<UE_UClass>("Class CoreUObject.Struct");
@@ -514,9 +991,12 @@ UE_UClass UE_UStruct::StaticClass()
 
 UE_FField UE_UStruct::FindChildProp(const std::string &name) const
 {
+    const UE_FNameQuery query(name);
+    if (query.IsResolved() && query.IsEmpty()) return {};
+
     for (auto prop = GetChildProperties(); prop; prop = prop.GetNext())
     {
-        if (prop.GetName() == name)
+        if (query.IsResolved() ? query.Matches(prop.GetFName()) : prop.GetName() == name)
             return prop;
     }
     return {};
@@ -524,9 +1004,12 @@ UE_FField UE_UStruct::FindChildProp(const std::string &name) const
 
 UE_UField UE_UStruct::FindChild(const std::string &name) const
 {
+    const UE_FNameQuery query(name);
+    if (query.IsResolved() && query.IsEmpty()) return {};
+
     for (auto prop = GetChildren(); prop; prop = prop.GetNext())
     {
-        if (prop.GetName() == name)
+        if (query.IsResolved() ? query.Matches(prop.GetFName()) : prop.GetNameView() == name)
             return prop;
     }
     return {};
@@ -552,9 +1035,26 @@ uint32_t UE_UFunction::GetFunctionEFlags() const
     return vm_rpm_ptr<uint32_t>(object + UEWrappers::GetOffsets()->UFunction.EFunctionFlags);
 }
 
+UEFunctionInfo UE_UFunction::GetFunctionInfo() const
+{
+    UEFunctionInfo info{};
+    if (!object) return info;
+
+    FunctionInfoView view(object, UEWrappers::pViewLayouts->UFunction);
+    info.Func = view.Get<0>();
+    info.NumParams = view.Get<1>();
+    info.ParamSize = view.Get<2>();
+    info.EFlags = view.Get<3>();
+    return info;
+}
+
 std::string UE_UFunction::GetFunctionFlags() const
 {
-    auto flags = GetFunctionEFlags();
+    return FunctionFlagsToString(GetFunctionEFlags());
+}
+
+std::string UE_UFunction::FunctionFlagsToString(uint32_t flags)
+{
     std::string result;
     if (flags == FUNC_None)
     {
@@ -1094,10 +1594,16 @@ UE_FField UE_FField::GetNext() const
     return vm_rpm_ptr<UE_FField>(object + UEWrappers::GetOffsets()->FField.Next);
 }
 
+UE_FName UE_FField::GetFName() const
+{
+    if (!object) return UE_FName();
+
+    return UE_FName(object + UEWrappers::GetOffsets()->FField.NamePrivate);
+}
+
 std::string UE_FField::GetName() const
 {
-    auto name = UE_FName(object + UEWrappers::GetOffsets()->FField.NamePrivate);
-    return name.GetName();
+    return GetFName().GetName();
 }
 
 UE_FFieldClass UE_FField::GetClass() const
@@ -1127,6 +1633,11 @@ uint64_t IFProperty::GetPropertyFlags() const
     return ((UE_FProperty *)prop)->GetPropertyFlags();
 }
 
+UEPropLayout IFProperty::GetLayout() const
+{
+    return ((UE_FProperty *)prop)->GetLayout();
+}
+
 std::pair<UEPropertyType, std::string> IFProperty::GetType() const
 {
     return ((UE_FProperty *)prop)->GetType();
@@ -1157,6 +1668,11 @@ uint64_t UE_FProperty::GetPropertyFlags() const
     return vm_rpm_ptr<uint64_t>(object + UEWrappers::GetOffsets()->FProperty.PropertyFlags);
 }
 
+UEPropLayout UE_FProperty::GetLayout() const
+{
+    return ReadPropLayout(object, UEWrappers::pViewLayouts->FProperty);
+}
+
 UEPropTypeInfo UE_FProperty::GetType() const
 {
     auto objectClass = GetClass();
@@ -1352,11 +1868,11 @@ uintptr_t UE_FProperty::FindSubFPropertyBaseOffset() const
 {
     uintptr_t offset = 0;
     uintptr_t temp = 0;
-    if (vm_rpm_ptr(object + UEWrappers::GetOffsets()->FProperty.Size, &temp, sizeof(uintptr_t)) && PtrValidator.isPtrReadable(temp))
+    if (vm_rpm_ptr(object + UEWrappers::GetOffsets()->FProperty.Size, &temp, sizeof(uintptr_t)) && IsPtrReadable(temp))
     {
         offset = UEWrappers::GetOffsets()->FProperty.Size;
     }
-    else if (vm_rpm_ptr(object + UEWrappers::GetOffsets()->FProperty.Size + sizeof(void *), &temp, sizeof(uintptr_t)) && PtrValidator.isPtrReadable(temp))
+    else if (vm_rpm_ptr(object + UEWrappers::GetOffsets()->FProperty.Size + sizeof(void *), &temp, sizeof(uintptr_t)) && IsPtrReadable(temp))
     {
         offset = UEWrappers::GetOffsets()->FProperty.Size + sizeof(void *);
     }
@@ -1365,7 +1881,7 @@ uintptr_t UE_FProperty::FindSubFPropertyBaseOffset() const
 
 UE_UStruct UE_FStructProperty::GetStruct() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1380,7 +1896,7 @@ std::string UE_FStructProperty::GetTypeStr() const
 
 UE_UClass UE_FObjectPropertyBase::GetPropertyClass() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1395,7 +1911,7 @@ std::string UE_FObjectPropertyBase::GetTypeStr() const
 
 UE_FProperty UE_FArrayProperty::GetInner() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1410,7 +1926,7 @@ std::string UE_FArrayProperty::GetTypeStr() const
 
 UE_UEnum UE_FByteProperty::GetEnum() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1460,7 +1976,7 @@ std::string UE_FBoolProperty::GetTypeStr() const
 
 UE_FProperty UE_FEnumProperty::GetUnderlayingProperty() const
 {
-    static uintptr_t off = 0;
+    static std::atomic<uintptr_t> off{0};
     if (off == 0)
     {
         auto p = vm_rpm_ptr<UE_FProperty>(object + UEWrappers::GetOffsets()->FProperty.Size);
@@ -1484,7 +2000,7 @@ UE_FProperty UE_FEnumProperty::GetUnderlayingProperty() const
 
 UE_UEnum UE_FEnumProperty::GetEnum() const
 {
-    static uintptr_t off = 0;
+    static std::atomic<uintptr_t> off{0};
     if (off == 0)
     {
         auto e = vm_rpm_ptr<UE_UEnum>(object + UEWrappers::GetOffsets()->FProperty.Size + sizeof(void *));
@@ -1516,7 +2032,7 @@ std::string UE_FEnumProperty::GetTypeStr() const
 
 UE_UClass UE_FClassProperty::GetMetaClass() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1537,7 +2053,7 @@ std::string UE_FSoftClassProperty::GetTypeStr() const
 
 UE_FProperty UE_FSetProperty::GetElementProp() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1552,7 +2068,7 @@ std::string UE_FSetProperty::GetTypeStr() const
 
 UE_FProperty UE_FMapProperty::GetKeyProp() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1562,7 +2078,7 @@ UE_FProperty UE_FMapProperty::GetKeyProp() const
 
 UE_FProperty UE_FMapProperty::GetValueProp() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
@@ -1577,7 +2093,7 @@ std::string UE_FMapProperty::GetTypeStr() const
 
 UE_UClass UE_FInterfaceProperty::GetInterfaceClass() const
 {
-    static uintptr_t offset = 0;
+    static std::atomic<uintptr_t> offset{0};
     if (offset == 0)
     {
         offset = FindSubFPropertyBaseOffset();
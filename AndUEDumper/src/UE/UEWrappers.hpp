@@ -3,10 +3,13 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "UEDisplayNameCache.hpp"
 #include "UEMemory.hpp"
+#include "UENameArena.hpp"
 #include "UEOffsets.hpp"
 
 class UE_UObjectArray;
@@ -16,6 +19,28 @@ namespace UEWrappers
     void Init(const UEVars *vars);
     UEVars const *GetUEVars();
     UE_UObjectArray *GetObjects();
+
+    struct ObjectValidationStats
+    {
+        uint64_t validated = 0;  // objects unchanged while processed
+        uint64_t retries = 0;    // objects processed again after a change
+        uint64_t skipped = 0;    // objects gone or still changing after the last retry
+    };
+
+    // optimistic re-validation of processed objects, for targets that keep running while dumping
+    void SetObjectValidation(bool enabled);
+    bool IsObjectValidationEnabled();
+    ObjectValidationStats GetObjectValidationStats();
+    void ResetObjectValidationStats();
+
+    // target can't change while dumping (snapshot replay or stopped game), no names are added meanwhile
+    void SetStaticTarget(bool isStatic);
+    bool IsStaticTarget();
+
+    // names handed out as views are interned here, cleared on Init
+    UENameArena::Stats GetNameArenaStats();
+    // display names by (ComparisonIndex, Number), cleared on Init
+    UEDisplayNameCache::Stats GetDisplayNamesStats();
 };  // namespace UEWrappers
 
 template <class T>
@@ -123,7 +148,35 @@ public:
     UE_FName(uint8_t *object) : object(object) {}
     UE_FName() : object(nullptr) {}
     int GetNumber() const;
+    // raw comparison index and number, number is 0 with outline numbers
+    bool GetIndex(int32_t *index, int32_t *number) const;
     std::string GetName() const;
+    // interned, valid until the next UEWrappers::Init
+    std::string_view GetNameView() const;
+
+    // formats name from an already read comparison index and number
+    static std::string GetName(int32_t index, int32_t number);
+    static std::string_view GetNameView(int32_t index, int32_t number);
+};
+
+// Display name resolved once to the (ComparisonIndex, Number) pairs displayed as it, so names can be
+// matched by their raw indices. Unresolved if the names table isn't fully cached, compare strings then.
+class UE_FNameQuery
+{
+    std::vector<std::pair<int32_t, int32_t>> _names;
+    bool _resolved;
+
+    void resolve(std::string_view name);
+
+public:
+    explicit UE_FNameQuery(std::string_view name);
+
+    bool IsResolved() const { return _resolved; }
+    // resolved to no names, nothing can match by index, only on static targets
+    bool IsEmpty() const { return _names.empty(); }
+
+    bool Matches(int32_t index, int32_t number) const;
+    bool Matches(const UE_FName &name) const;
 };
 
 enum class UEPropertyType
@@ -235,8 +288,12 @@ public:
     UE_UClass GetClass() const;
     UE_UObject GetOuter() const;
     UE_UObject GetPackageObject() const;
+    UE_FName GetFName() const;
     std::string GetName() const;
+    std::string_view GetNameView() const;
     std::string GetFullName() const;
+    // assembles into out, reusing its storage
+    void GetFullName(std::string *out) const;
     std::string GetCppName() const;
     uint8_t *GetAddress() const { return object; }
     operator uint8_t *() const { return object; };
@@ -258,6 +315,22 @@ public:
     static UE_UClass StaticClass();
 };
 
+// Identity of an object and its GUObjectArray slot, equal stamps before and after processing mean GC didn't touch it meanwhile
+struct UEObjectStamp
+{
+    static constexpr size_t kMaxItemSize = 0x20;
+
+    uint8_t *cls = nullptr;
+    uint8_t *outer = nullptr;
+    uint64_t name = 0;
+    int32_t index = -1;
+    // FUObjectItem copy, object pointer followed by internal flags and serial number
+    uint8_t item[kMaxItemSize] = {};
+
+    bool operator==(const UEObjectStamp &other) const;
+    bool operator!=(const UEObjectStamp &other) const { return !(*this == other); }
+};
+
 class UE_UObjectArray
 {
 public:
@@ -265,58 +338,90 @@ public:
     UE_UObjectArray(void *objects) : Objects((uint8_t **)objects) {}
     UE_UObjectArray(uintptr_t objects) : Objects((uint8_t **)objects) {}
 
+    // objects pointers read per batch when walking the array
+    static constexpr int32_t kObjectsBatchSize = 1024;
+
     uint8_t **Objects;
 
     int32_t GetNumElements() const;
 
+    // address of FUObjectItem for slot id, 0 if invalid
+    uintptr_t GetObjectItemAddress(int32_t id) const;
+
     uint8_t *GetObjectPtr(int32_t id) const;
 
+    // reads object pointers of [start, start + count) in batched reads
+    // unreadable entries are set to nullptr, returns count of read entries
+    int32_t GetObjectPtrs(int32_t start, int32_t count, uint8_t **out) const;
+
     void ForEachObject(const std::function<bool(UE_UObject)> &callback) const;
     void ForEachObjectOfClass(const class UE_UClass &cmp, const std::function<bool(UE_UObject)> &callback) const;
 
     bool IsObject(const UE_UObject &address) const;
 
+    static constexpr int kMaxValidationRetries = 3;
+
+    // reads object identity, fails if the object isn't in its own GUObjectArray slot
+    bool ReadObjectStamp(const UE_UObject &object, UEObjectStamp *out) const;
+
+    // when validation is enabled, calls process() until object stamp is the same before and after it
+    // process() must reset its own output on every call, returns false if object is gone or kept changing
+    bool ProcessValidated(const UE_UObject &object, const std::function<void()> &process) const;
+
+    // same as above for the object in slot id, the slot is re-read on every retry
+    bool ProcessValidated(int32_t id, const std::function<void(UE_UObject)> &process) const;
+
     template <typename T = UE_UObject>
     T FindObject(const std::string &fullName) const
     {
-        for (int32_t i = 0; i < GetNumElements(); i++)
+        T result{};
+        // object name is the last path component, candidates are then compared by full name
+        const size_t nameStart = fullName.find_last_of(". ");
+        const UE_FNameQuery query(std::string_view(fullName).substr(nameStart == std::string::npos ? 0 : nameStart + 1));
+
+        std::string objectFullName;
+        ForEachObject([&](UE_UObject object)
         {
-            UE_UObject object = GetObjectPtr(i);
-            if (object && object.GetFullName() == fullName)
-            {
-                return object.Cast<T>();
-            }
-        }
-        return T();
+            if (query.IsResolved() && !query.IsEmpty() && !query.Matches(object.GetFName())) return false;
+            object.GetFullName(&objectFullName);
+            if (objectFullName != fullName) return false;
+            result = object.Cast<T>();
+            return true;
+        });
+        return result;
     }
 
     template <typename T = UE_UObject>
     T FindObjectFast(const std::string &name) const
     {
-        for (int32_t i = 0; i < GetNumElements(); i++)
+        T result{};
+        const UE_FNameQuery query(name);
+        if (query.IsResolved() && query.IsEmpty()) return result;
+
+        ForEachObject([&](UE_UObject object)
         {
-            UE_UObject object = GetObjectPtr(i);
-            if (object && object.GetName() == name)
-            {
-                return object.Cast<T>();
-            }
-        }
-        return T();
+            if (query.IsResolved() ? !query.Matches(object.GetFName()) : object.GetNameView() != name) return false;
+            result = object.Cast<T>();
+            return true;
+        });
+        return result;
     }
 
     template <typename T = UE_UObject>
     T FindObjectFastInOuter(const std::string &name, const std::string &outer)
     {
-        for (int32_t i = 0; i < GetNumElements(); i++)
-        {
-            UE_UObject object = GetObjectPtr(i);
-            if (object.GetName() == name && object.GetOuter().GetName() == outer)
-            {
-                return object.Cast<T>();
-            }
-        }
+        T result{};
+        const UE_FNameQuery nameQuery(name), outerQuery(outer);
+        if ((nameQuery.IsResolved() && nameQuery.IsEmpty()) || (outerQuery.IsResolved() && outerQuery.IsEmpty())) return result;
 
-        return T();
+        ForEachObject([&](UE_UObject object)
+        {
+            if (nameQuery.IsResolved() ? !nameQuery.Matches(object.GetFName()) : object.GetNameView() != name) return false;
+            if (outerQuery.IsResolved() ? !outerQuery.Matches(object.GetOuter().GetFName()) : object.GetOuter().GetNameView() != outer) return false;
+            result = object.Cast<T>();
+            return true;
+        });
+        return result;
     }
 };
 
@@ -404,6 +509,33 @@ enum EPropertyFlags : uint64_t
 
 typedef std::pair<UEPropertyType, std::string> UEPropTypeInfo;
 
+// property fields that are read together in one batch
+struct UEPropLayout
+{
+    int32_t ArrayDim = 0;
+    int32_t ElementSize = 0;
+    int32_t Offset = 0;
+    uint64_t PropertyFlags = 0;
+};
+
+// UStruct fields read together with one UERemoteView
+struct UEStructInfo
+{
+    uint8_t *Super = nullptr;
+    uint8_t *Children = nullptr;
+    uint8_t *ChildProperties = nullptr;
+    int32_t Size = 0;
+};
+
+// UFunction fields read together with one UERemoteView
+struct UEFunctionInfo
+{
+    uintptr_t Func = 0;
+    int8_t NumParams = 0;
+    int16_t ParamSize = 0;
+    uint32_t EFlags = 0;
+};
+
 class IProperty
 {
 protected:
@@ -416,6 +548,7 @@ public:
     virtual int32_t GetSize() const = 0;
     virtual int32_t GetOffset() const = 0;
     virtual uint64_t GetPropertyFlags() const = 0;
+    virtual UEPropLayout GetLayout() const = 0;
     virtual UEPropTypeInfo GetType() const = 0;
     virtual uint8_t GetFieldMask() const = 0;
 };
@@ -430,6 +563,7 @@ public:
     virtual int32_t GetSize() const;
     virtual int32_t GetOffset() const;
     virtual uint64_t GetPropertyFlags() const;
+    virtual UEPropLayout GetLayout() const;
     virtual UEPropTypeInfo GetType() const;
     virtual uint8_t GetFieldMask() const;
 };
@@ -442,6 +576,7 @@ public:
     int32_t GetSize() const;
     int32_t GetOffset() const;
     uint64_t GetPropertyFlags() const;
+    UEPropLayout GetLayout() const;
     UEPropTypeInfo GetType() const;
 
     IUProperty GetInterface() const;
@@ -456,8 +591,17 @@ public:
     UE_FField GetChildProperties() const;
     UE_UField GetChildren() const;
     int32_t GetSize() const;
+    UEStructInfo GetInfo() const;
     static UE_UClass StaticClass();
 
+    // Walk the chains reading each node property footprint in one read,
+    // following reads of the nodes are served locally while a UEMemory::Prefetch::Scope is active
+    std::vector<UE_FField> PrefetchChildProperties() const;
+    std::vector<UE_UField> PrefetchChildren() const;
+    // same from chain heads already read, e.g. with GetInfo()
+    static std::vector<UE_FField> PrefetchChildProperties(UE_FField head);
+    static std::vector<UE_UField> PrefetchChildren(UE_UField head);
+
     UE_FField FindChildProp(const std::string &name) const;
     UE_UField FindChild(const std::string &name) const;
 };
@@ -512,6 +656,9 @@ public:
 
     uint32_t GetFunctionEFlags() const;
     std::string GetFunctionFlags() const;
+    static std::string FunctionFlagsToString(uint32_t flags);
+
+    UEFunctionInfo GetFunctionInfo() const;
     static UE_UClass StaticClass();
 };
 
@@ -814,6 +961,7 @@ public:
     operator bool() const { return object != nullptr; }
 
     UE_FField GetNext() const;
+    UE_FName GetFName() const;
     std::string GetName() const;
     UE_FFieldClass GetClass() const;
 
@@ -833,6 +981,7 @@ public:
     virtual int32_t GetSize() const;
     virtual int32_t GetOffset() const;
     virtual uint64_t GetPropertyFlags() const;
+    virtual UEPropLayout GetLayout() const;
     virtual UEPropTypeInfo GetType() const;
     virtual uint8_t GetFieldMask() const;
 };
@@ -845,6 +994,7 @@ public:
     int32_t GetSize() const;
     int32_t GetOffset() const;
     uint64_t GetPropertyFlags() const;
+    UEPropLayout GetLayout() const;
     UEPropTypeInfo GetType() const;
     IFProperty GetInterface() const;
 
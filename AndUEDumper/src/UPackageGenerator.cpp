@@ -45,15 +45,18 @@ void UE_UPackage::GenerateFunction(const UE_UFunction &fn, Function *out)
 {
     out->Name = fn.GetName();
     out->FullName = fn.GetFullName();
-    out->EFlags = fn.GetFunctionEFlags();
-    out->Flags = fn.GetFunctionFlags();
-    out->NumParams = fn.GetNumParams();
-    out->ParamSize = fn.GetParamSize();
-    out->Func = fn.GetFunc();
+
+    const UEFunctionInfo info = fn.GetFunctionInfo();
+    out->EFlags = info.EFlags;
+    out->Flags = UE_UFunction::FunctionFlagsToString(info.EFlags);
+    out->NumParams = info.NumParams;
+    out->ParamSize = info.ParamSize;
+    out->Func = info.Func;
 
     auto generateParam = [&](IProperty *prop)
     {
-        auto flags = prop->GetPropertyFlags();
+        auto layout = prop->GetLayout();
+        auto flags = layout.PropertyFlags;
 
         // if property has 'ReturnParm' flag
         if (flags & CPF_ReturnParm)
@@ -63,7 +66,7 @@ void UE_UPackage::GenerateFunction(const UE_UFunction &fn, Function *out)
         // if property has 'Parm' flag
         else if (flags & CPF_Parm)
         {
-            if (prop->GetArrayDim() > 1)
+            if (layout.ArrayDim > 1)
             {
                 out->Params += fmt::format("{}* {}, ", prop->GetType().second, prop->GetName());
             }
@@ -81,13 +84,20 @@ void UE_UPackage::GenerateFunction(const UE_UFunction &fn, Function *out)
         }
     };
 
-    for (auto prop = fn.GetChildProperties().Cast<UE_FProperty>(); prop; prop = prop.GetNext().Cast<UE_FProperty>())
+    // chain heads in one read
+    const UEStructInfo structInfo = fn.GetInfo();
+
+    UEMemory::Prefetch::Scope prefetchScope;
+
+    for (auto field : UE_UStruct::PrefetchChildProperties(structInfo.ChildProperties))
     {
+        auto prop = field.Cast<UE_FProperty>();
         auto propInterface = prop.GetInterface();
         generateParam(&propInterface);
     }
-    for (auto prop = fn.GetChildren().Cast<UE_UProperty>(); prop; prop = prop.GetNext().Cast<UE_UProperty>())
+    for (auto field : UE_UStruct::PrefetchChildren(structInfo.Children))
     {
+        auto prop = field.Cast<UE_UProperty>();
         auto propInterface = prop.GetInterface();
         generateParam(&propInterface);
     }
@@ -112,7 +122,9 @@ void UE_UPackage::GenerateStruct(const UE_UStruct &object, std::vector<Struct> &
     s.CppName += object.GetCppName();
     s.addr = object.GetAddress();
     s.Inherited = 0;
-    s.Size = object.GetSize();
+
+    const UEStructInfo info = object.GetInfo();
+    s.Size = info.Size;
 
     if (s.Size == 0)
     {
@@ -120,7 +132,7 @@ void UE_UPackage::GenerateStruct(const UE_UStruct &object, std::vector<Struct> &
         return;
     }
 
-    auto super = object.GetSuper();
+    UE_UStruct super(info.Super);
     if (super)
     {
         s.CppName += " : ";
@@ -133,8 +145,9 @@ void UE_UPackage::GenerateStruct(const UE_UStruct &object, std::vector<Struct> &
 
     auto generateMember = [&](IProperty *prop, Member *m)
     {
-        auto arrDim = prop->GetArrayDim();
-        m->Size = prop->GetSize() * arrDim;
+        auto layout = prop->GetLayout();
+        auto arrDim = layout.ArrayDim;
+        m->Size = layout.ElementSize * arrDim;
         if (m->Size == 0)
         {
             return;
@@ -143,7 +156,7 @@ void UE_UPackage::GenerateStruct(const UE_UStruct &object, std::vector<Struct> &
         auto type = prop->GetType();
         m->Type = type.second;
         m->Name = prop->GetName();
-        m->Offset = prop->GetOffset();
+        m->Offset = layout.Offset;
 
         if (m->Offset > offset)
         {
@@ -191,15 +204,18 @@ void UE_UPackage::GenerateStruct(const UE_UStruct &object, std::vector<Struct> &
         }
     };
 
-    for (auto prop = object.GetChildProperties().Cast<UE_FProperty>(); prop; prop = prop.GetNext().Cast<UE_FProperty>())
+    UEMemory::Prefetch::Scope prefetchScope;
+
+    for (auto field : UE_UStruct::PrefetchChildProperties(info.ChildProperties))
     {
+        auto prop = field.Cast<UE_FProperty>();
         Member m;
         auto propInterface = prop.GetInterface();
         generateMember(&propInterface, &m);
         s.Members.push_back(m);
     }
 
-    for (auto child = object.GetChildren(); child; child = child.GetNext())
+    for (auto child : UE_UStruct::PrefetchChildren(info.Children))
     {
         if (child.IsA<UE_UFunction>())
         {
@@ -237,20 +253,43 @@ void UE_UPackage::GenerateEnum(const UE_UEnum &object, std::vector<Enum> &arr)
     auto names = object.GetNames();
     uint64_t max = 0;
 
-    for (int32_t i = 0; i < names.Num(); i++)
+    // remote count, a corrupt array mustn't size the buffer
+    constexpr int32_t kMaxEnumNames = 0x10000;
+
+    const int32_t numNames = names.Num();
+    if (numNames > 0 && numNames <= names.Max() && numNames <= kMaxEnumNames && names.GetData())
     {
-        auto pair = names.GetData() + i * pairSize;
-        auto name = UE_FName(pair);
-        auto str = name.GetName();
-        auto pos = str.find_last_of(':');
-        if (pos != std::string::npos)
-            str = str.substr(pos + 1);
-
-        auto value = vm_rpm_ptr<uint64_t>(pair + nameSize);
-        if (value > max)
-            max = value;
-
-        e.Members.emplace_back(str, value);
+        // pairs are contiguous, one read for all of them
+        std::vector<uint8_t> pairsBuffer(numNames * pairSize, 0);
+        const bool pairsRead = vm_rpm_ptr(names.GetData(), pairsBuffer.data(), pairsBuffer.size());
+
+        const auto &fnameOff = UEWrappers::GetUEVars()->GetOffsets()->FName;
+        const bool outlineNumber = UEWrappers::GetUEVars()->GetOffsets()->Config.isUsingOutlineNumberName;
+
+        for (int32_t i = 0; i < numNames; i++)
+        {
+            std::string str = "None";
+            uint64_t value = 0;
+
+            const uint8_t *pair = pairsBuffer.data() + i * pairSize;
+            if (pairsRead)
+            {
+                int32_t index = *(int32_t *)(pair + fnameOff.ComparisonIndex);
+                int32_t number = outlineNumber ? 0 : *(int32_t *)(pair + fnameOff.Number);
+
+                str = UE_FName::GetName(index, number);
+                value = *(uint64_t *)(pair + nameSize);
+            }
+
+            auto pos = str.find_last_of(':');
+            if (pos != std::string::npos)
+                str = str.substr(pos + 1);
+
+            if (value > max)
+                max = value;
+
+            e.Members.emplace_back(str, value);
+        }
     }
 
     // enum values should be in ascending order
@@ -353,18 +392,38 @@ void UE_UPackage::Process()
     auto &objects = Package->second;
     for (auto &object : objects)
     {
-        if (object.IsA<UE_UClass>())
-        {
-            GenerateStruct(object.Cast<UE_UStruct>(), Classes);
-        }
-        else if (object.IsA<UE_UScriptStruct>())
+        const size_t classesCount = Classes.size();
+        const size_t structuresCount = Structures.size();
+        const size_t enumsCount = Enums.size();
+
+        // drops output of a previous attempt on the same object
+        auto rollback = [&]()
         {
-            GenerateStruct(object.Cast<UE_UStruct>(), Structures);
-        }
-        else if (object.IsA<UE_UEnum>())
+            Classes.resize(classesCount);
+            Structures.resize(structuresCount);
+            Enums.resize(enumsCount);
+        };
+
+        bool valid = UEWrappers::GetObjects()->ProcessValidated(object, [&]()
         {
-            GenerateEnum(object.Cast<UE_UEnum>(), Enums);
-        }
+            rollback();
+
+            if (object.IsA<UE_UClass>())
+            {
+                GenerateStruct(object.Cast<UE_UStruct>(), Classes);
+            }
+            else if (object.IsA<UE_UScriptStruct>())
+            {
+                GenerateStruct(object.Cast<UE_UStruct>(), Structures);
+            }
+            else if (object.IsA<UE_UEnum>())
+            {
+                GenerateEnum(object.Cast<UE_UEnum>(), Enums);
+            }
+        });
+
+        if (!valid)
+            rollback();
     }
 }
 
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <utfcpp/unchecked.h>
+
+namespace UTFUtils
+{
+    // Narrows leading ASCII code units 8 at a time, returns count of units written to out.
+    inline size_t NarrowASCII16(const char16_t *str, size_t len, char *out)
+    {
+        size_t i = 0;
+
+#if defined(__aarch64__)
+        for (; i + 8 <= len; i += 8)
+        {
+            uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t *>(str + i));
+            if (vmaxvq_u16(v) >= 0x80) break;
+
+            vst1_u8(reinterpret_cast<uint8_t *>(out + i), vmovn_u16(v));
+        }
+#elif defined(__SSE2__)
+        const __m128i nonAsciiMask = _mm_set1_epi16(int16_t(0xFF80));
+        for (; i + 8 <= len; i += 8)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, nonAsciiMask), _mm_setzero_si128())) != 0xFFFF) break;
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(v, v));
+        }
+#endif
+
+        for (; i < len && str[i] < 0x80; i++)
+            out[i] = char(str[i]);
+
+        return i;
+    }
+
+    // UTF-16 to UTF-8, ASCII runs are narrowed in bulk and the rest goes through utfcpp.
+    inline std::string UTF16ToUTF8(const char16_t *str, size_t len)
+    {
+        std::string result;
+        if (!str || len == 0) return result;
+
+        result.resize(len);
+        size_t ascii = NarrowASCII16(str, len, &result[0]);
+        if (ascii == len) return result;
+
+        result.resize(ascii);
+        utf8::unchecked::utf16to8(str + ascii, str + len, std::back_inserter(result));
+        return result;
+    }
+
+    inline std::string UTF16ToUTF8(const std::u16string &str)
+    {
+        return UTF16ToUTF8(str.data(), str.size());
+    }
+}  // namespace UTFUtils
@@ -1,4 +1,5 @@
 
+#include <algorithm>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
@@ -16,7 +17,10 @@
 #include "Dumper.hpp"
 
 #include "UE/UEMemory.hpp"
+#include "UE/UEBenchmark.hpp"
 #include "UE/UEGameProfile.hpp"
+#include "UE/UEProcessFreeze.hpp"
+#include "UE/UESnapshot.hpp"
 
 #include "UE/UEGameProfiles/ArenaBreakout.hpp"
 #include "UE/UEGameProfiles/BlackClover.hpp"
@@ -103,6 +107,36 @@ int main(int argc, char **args)
     bool bDumpLib = false;
     cmdline.addFlag("-d", "--dumplib", "dump UE library from memory.", false, &bDumpLib);
 
+    bool bPageCache = false;
+    cmdline.addFlag("-c", "--cache", "cache target memory pages while dumping.", false, &bPageCache);
+
+    bool bBenchmark = false;
+    cmdline.addFlag("-b", "--benchmark", "run memory micro benchmarks before dumping.", false, &bBenchmark);
+
+    char sSnapshotPath[0xff] = {0};
+    cmdline.addScanf("-s", "--snapshot", "save target memory snapshot to file for offline replay.", false, "%s", sSnapshotPath);
+
+    char sReplayPath[0xff] = {0};
+    cmdline.addScanf("-r", "--replay", "dump from a memory snapshot file instead of the running game.", false, "%s", sReplayPath);
+
+    int nReadThreads = 1;
+    cmdline.addScanf("-j", "--jobs", "number of threads reading target memory, default 1.", false, "%d", &nReadThreads);
+
+    bool bFreeze = false;
+    cmdline.addFlag("-f", "--freeze", "stop the game while dumping, caches all target memory pages.", false, &bFreeze);
+
+    bool bValidate = false;
+    cmdline.addFlag("-v", "--validate", "re-validate objects that the game changes while dumping.", false, &bValidate);
+
+    char sTracePath[0xff] = {0};
+    cmdline.addScanf("-t", "--trace", "record all target memory reads to a trace file.", false, "%s", sTracePath);
+
+    char sTraceReplayPath[0xff] = {0};
+    cmdline.addScanf("-T", "--trace-replay", "replay a trace file against the snapshot given with -r and exit.", false, "%s", sTraceReplayPath);
+
+    char sMirrorPath[0xff] = {0};
+    cmdline.addScanf("-m", "--mirror", "keep read pages in a mirror file, repeated dumps re-read them in bulk and report changes.", false, "%s", sMirrorPath);
+
     cmdline.parseArgs();
 
     if (bNeededHelp)
@@ -123,6 +157,47 @@ int main(int argc, char **args)
         return 1;
     }
 
+    std::string sSnapshotFile = sSnapshotPath, sReplayFile = sReplayPath;
+    const bool bReplay = !sReplayFile.empty();
+
+    UESnapshotFile replaySnapshot{};
+    if (bReplay)
+    {
+        if (!replaySnapshot.Open(sReplayFile))
+        {
+            LOGE("Failed to open snapshot file.");
+            return 1;
+        }
+        sGamePackage = replaySnapshot.GetPackage();
+    }
+
+    std::string sTraceFile = sTracePath, sTraceReplayFile = sTraceReplayPath;
+    std::string sMirrorFile = sMirrorPath;
+    if (!sTraceReplayFile.empty())
+    {
+        if (!bReplay)
+        {
+            LOGE("Trace replay needs a snapshot file, see -r.");
+            return 1;
+        }
+
+        LOGI("Replaying trace: %s", sTraceReplayFile.c_str());
+        UEMemory::SetBackend(&replaySnapshot);
+        auto results = UEBenchmark::ReplayTrace(sTraceReplayFile);
+        UEMemory::SetBackend(nullptr);
+
+        if (results.empty())
+        {
+            LOGE("Failed to replay trace file.");
+            return 1;
+        }
+
+        for (const auto &result : results)
+            LOGI("%s", result.ToString().c_str());
+
+        return 0;
+    }
+
     if (sGamePackage.empty())
     {
         std::sort(UE_Games.begin(), UE_Games.end(), [](const IGameProfile *a, const IGameProfile *b)
@@ -157,17 +232,29 @@ int main(int argc, char **args)
         sGamePackage = UE_Games[gameIndexMap[gameNumber].first]->GetAppIDs()[gameIndexMap[gameNumber].second];
     }
 
-    pid_t gamePID = KittyMemoryEx::getProcessID(sGamePackage);
-    if (gamePID < 1)
+    pid_t gamePID = 0;
+    if (!bReplay)
     {
-        LOGE("Couldn't find \"%s\" in the running processes list.", sGamePackage.c_str());
-        return 1;
+        gamePID = KittyMemoryEx::getProcessID(sGamePackage);
+        if (gamePID < 1)
+        {
+            LOGE("Couldn't find \"%s\" in the running processes list.", sGamePackage.c_str());
+            return 1;
+        }
     }
 
     LOGI("Game: %s", sGamePackage.c_str());
-    LOGI("Process ID: %d", gamePID);
+    if (bReplay)
+        LOGI("Replay Snapshot: %s", sReplayFile.c_str());
+    else
+        LOGI("Process ID: %d", gamePID);
     LOGI("Output directory: %s", sOutDirectory.c_str());
     LOGI("Dump Library: %s", bDumpLib ? "true" : "false");
+    LOGI("Page Cache: %s", bPageCache ? "true" : "false");
+    LOGI("Read Threads: %d", std::max(nReadThreads, 1));
+    LOGI("Freeze Game: %s", (bFreeze && !bReplay) ? "true" : "false");
+    LOGI("Validate Objects: %s", (bValidate && !bReplay && !bFreeze) ? "true" : "false");
+    LOGI("Page Mirror: %s", (!sMirrorFile.empty() && !bReplay) ? sMirrorFile.c_str() : "false");
     LOGI("==========================");
 
     std::string sDumpDir = sOutDirectory + "/UEDump3r";
@@ -181,13 +268,58 @@ int main(int argc, char **args)
         return 1;
     }
 
-    LOGI("Initializing Memory...");
-    if (!kMgr.initialize(gamePID, EK_MEM_OP_SYSCALL, false) && !kMgr.initialize(gamePID, EK_MEM_OP_IO, false))
+    if (!bReplay)
     {
-        LOGE("Failed to initialize KittyMemoryMgr.");
-        return 1;
+        LOGI("Initializing Memory...");
+        if (!kMgr.initialize(gamePID, EK_MEM_OP_SYSCALL, false) && !kMgr.initialize(gamePID, EK_MEM_OP_IO, false))
+        {
+            LOGE("Failed to initialize KittyMemoryMgr.");
+            return 1;
+        }
     }
 
+    // resumed at done or on any exit path
+    UEProcessFreeze targetFreeze{};
+    if (bFreeze && !bReplay)
+    {
+        LOGI("Stopping game process...");
+        if (!targetFreeze.Freeze(gamePID))
+        {
+            LOGE("Failed to stop game process.");
+            return 1;
+        }
+    }
+
+    if (targetFreeze.IsFrozen())
+    {
+        // memory can't change while stopped, keep every page read
+        PageCache::Enable(0);
+    }
+    else if (bPageCache)
+    {
+        PageCache::Enable();
+    }
+
+    ReadExecutor::SetThreadCount(size_t(std::max(nReadThreads, 1)));
+
+    if (!sMirrorFile.empty() && !bReplay)
+    {
+        LOGI("Refreshing page mirror...");
+        Mirror::Enable();
+        if (!Mirror::Load(sMirrorFile))
+            LOGW("Couldn't load page mirror, starting empty.");
+
+        Mirror::Refresh();
+        auto mirrorStats = Mirror::GetStats();
+        LOGI("Pages: %zu | Clean: %zu | Changed: %zu | Dropped: %zu | %zu bulk reads in %.2fms",
+             mirrorStats.pages, mirrorStats.clean, mirrorStats.changed, mirrorStats.dropped, mirrorStats.bulkReads, mirrorStats.refreshMS);
+        LOGI("==========================");
+    }
+
+    // snapshots and stopped games can't change
+    UEWrappers::SetObjectValidation(bValidate && !bReplay && !targetFreeze.IsFrozen());
+    UEWrappers::SetStaticTarget(bReplay || targetFreeze.IsFrozen());
+
     UEDumper uEDumper{};
 
     uEDumper.setDumpExeInfoNotify([](bool bFinished)
@@ -260,6 +392,16 @@ int main(int argc, char **args)
         }
     });
 
+    if (!sTraceFile.empty())
+    {
+        if (!Trace::Start(sTraceFile))
+        {
+            LOGE("Failed to create trace file.");
+            return 1;
+        }
+        Trace::SetPhase("Init");
+    }
+
     bool dumpSuccess = false;
     std::unordered_map<std::string, BufferFmt> dumpbuffersMap;
     auto dmpStart = std::chrono::steady_clock::now();
@@ -271,7 +413,7 @@ int main(int argc, char **args)
             if (sGamePackage != pkg)
                 continue;
 
-            if (bDumpLib)
+            if (bDumpLib && !bReplay)
             {
                 auto ue_elf = it->GetUnrealEngineELF();
                 if (!ue_elf.isValid())
@@ -287,8 +429,44 @@ int main(int argc, char **args)
             }
 
             LOGI("Initializing Dumper...");
-            if (uEDumper.Init(it))
+            if (bReplay ? uEDumper.Init(it, &replaySnapshot) : uEDumper.Init(it))
             {
+                if (!bReplay)
+                {
+                    LOGI("Calibrating memory ops...");
+                    LOGI("%s", MemOps::Calibrate(kMgr.processID(), it->GetUnrealEngineELF().segments()).ToString().c_str());
+                    LOGI("==========================");
+                }
+
+                if (!bReplay && !sSnapshotFile.empty())
+                {
+                    LOGI("Saving memory snapshot...");
+                    UESnapshotFile::CaptureStats snapshotStats{};
+                    if (UESnapshotFile::Capture(sSnapshotFile, it, &snapshotStats))
+                    {
+                        LOGI("Snapshot: %s", sSnapshotFile.c_str());
+                        LOGI("Regions: %zu | Stored: %zu KB | Zero Fill: %zu KB | Unreadable: %zu KB",
+                             snapshotStats.regions, snapshotStats.bytesStored / 1024,
+                             snapshotStats.bytesZeroFill / 1024, snapshotStats.bytesFailed / 1024);
+                    }
+                    else
+                    {
+                        LOGE("Failed to save memory snapshot.");
+                    }
+                    LOGI("==========================");
+                }
+
+                if (bBenchmark)
+                {
+                    // benchmark reads aren't part of the dump, keep them out of the trace
+                    Trace::Pause();
+                    LOGI("Running Benchmarks...");
+                    for (const auto &result : UEBenchmark::RunAll(it))
+                        LOGI("%s", result.ToString().c_str());
+                    LOGI("==========================");
+                    Trace::Resume();
+                }
+
                 dumpSuccess = uEDumper.Dump(&dumpbuffersMap);
             }
 
@@ -298,6 +476,22 @@ int main(int argc, char **args)
 
 done:
 
+    targetFreeze.Resume();
+
+    if (Mirror::IsEnabled())
+    {
+        if (Mirror::Save(sMirrorFile))
+            LOGI("Page Mirror: %s", sMirrorFile.c_str());
+        else
+            LOGE("Failed to save page mirror.");
+    }
+
+    if (Trace::IsActive())
+    {
+        Trace::Stop();
+        LOGI("Trace: %s", sTraceFile.c_str());
+    }
+
     if (!dumpSuccess && uEDumper.GetLastError().empty())
     {
         LOGE("Game is not supported. check AppID.");
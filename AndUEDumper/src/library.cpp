@@ -14,6 +14,7 @@
 
 #include "UE/UEMemory.hpp"
 #include "UE/UEGameProfile.hpp"
+#include "UE/UELocalMemory.hpp"
 
 #include "UE/UEGameProfiles/ArenaBreakout.hpp"
 #include "UE/UEGameProfiles/BlackClover.hpp"
@@ -128,6 +129,26 @@ void dump_thread(bool bDumpLib)
         return;
     }
 
+    // dumping from inside the game, read memory directly instead of syscalls
+    UELocalMemoryBackend localMemory{};
+    if (localMemory.Install())
+        UEMemory::SetBackend(&localMemory);
+    else
+        LOGW("Failed to install local memory backend, using kMgr reads.");
+
+    // game keeps running while dumping from inside
+    UEWrappers::SetObjectValidation(true);
+
+    // process wide state is restored on every return, before localMemory is destroyed
+    struct DumpStateGuard
+    {
+        ~DumpStateGuard()
+        {
+            UEMemory::SetBackend(nullptr);
+            UEWrappers::SetObjectValidation(false);
+        }
+    } dumpStateGuard;
+
     UEDumper uEDumper{};
 
     uEDumper.setDumpExeInfoNotify([](bool bFinished)
@@ -211,6 +232,13 @@ void dump_thread(bool bDumpLib)
             LOGI("Initializing Dumper...");
             if (uEDumper.Init(it))
             {
+                // only matters when reads go through kMgr
+                if (!UEMemory::GetBackend())
+                {
+                    LOGI("Calibrating memory ops...");
+                    LOGI("%s", UEMemory::MemOps::Calibrate(kMgr.processID(), it->GetUnrealEngineELF().segments()).ToString().c_str());
+                }
+
                 dumpSuccess = uEDumper.Dump(&dumpbuffersMap);
             }
 